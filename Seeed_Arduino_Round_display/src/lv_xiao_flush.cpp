@@ -0,0 +1,375 @@
+#include "lv_xiao_round_screen.h"
+
+/*
+  LVGL flush / wait callbacks and draw buffers. Nothing in here touches the
+  hardware directly, everything goes through xiao_bus_*(), so the same file
+  runs against the host stand-in bus.
+*/
+
+static xiao_flush_stats_t flush_stats;
+
+// Run while a frame renders, see lv_xiao_disp_set_poll_cb()
+static void (*poll_cb)(void) = NULL;
+
+// Where heap draw buffers come from, see lv_xiao_disp_set_allocator()
+static void *(*buf_alloc)(size_t bytes) = malloc;
+static void  (*buf_release)(void *ptr)  = free;
+
+// Rectangles of the strip on the bus; only one strip is ever in flight
+static xiao_segment_t segments[SCREEN_HEIGHT];
+
+// -------------------------------------------------------------------------
+// Round panel clipping
+// -------------------------------------------------------------------------
+#if LVGL_ROUND_CLIP
+// First / last visible column of every row (inclusive)
+static uint8_t span_start[SCREEN_HEIGHT];
+static uint8_t span_end[SCREEN_HEIGHT];
+
+static void build_spans(void)
+{
+    // In half pixels: a pixel is kept if its centre is within r + 0.5 of the
+    // panel centre, so edge pixels that are partly visible still go out
+    int32_t r2 = (SCREEN_WIDTH + 1) * (SCREEN_WIDTH + 1);
+
+    for (int32_t y = 0; y < SCREEN_HEIGHT; y++) {
+        int32_t dy = 2 * y + 1 - SCREEN_HEIGHT;
+        int32_t x  = 0;
+        while (x < SCREEN_WIDTH / 2) {
+            int32_t dx = 2 * x + 1 - SCREEN_WIDTH;
+            if (dx * dx + dy * dy <= r2) {
+                break;
+            }
+            x++;
+        }
+        span_start[y] = x;
+        span_end[y]   = SCREEN_WIDTH - 1 - x;
+    }
+}
+
+/*
+  Splits a strip into what has to go on the wire. Either one rectangle around
+  everything visible (rows compacted in place, LVGL's buffer is ours until
+  flush_ready) or one rectangle per row, whichever is fewer bytes including
+  the window commands. Returns the number of segments, 0 = nothing visible.
+*/
+static uint16_t clip_to_circle(const lv_area_t *area, uint16_t *px)
+{
+    lv_coord_t w = lv_area_get_width(area);
+
+    lv_area_t box = {LV_COORD_MAX, LV_COORD_MAX, -1, -1};
+    uint32_t  row_px = 0;
+    uint16_t  rows   = 0;
+    for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+        lv_coord_t xs = LV_MAX(area->x1, span_start[y]);
+        lv_coord_t xe = LV_MIN(area->x2, span_end[y]);
+        if (xs > xe) {
+            continue;
+        }
+        box.x1 = LV_MIN(box.x1, xs);
+        box.x2 = LV_MAX(box.x2, xe);
+        box.y1 = LV_MIN(box.y1, y);
+        box.y2 = y;
+        row_px += xe - xs + 1;
+        rows++;
+    }
+    if (rows == 0) {
+        return 0;
+    }
+
+    uint32_t row_cost = row_px * 2 + rows * XIAO_WINDOW_BYTES;
+    uint32_t box_cost = lv_area_get_size(&box) * 2 + XIAO_WINDOW_BYTES;
+
+    if (row_cost < box_cost) {
+        uint16_t n = 0;
+        for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+            lv_coord_t xs = LV_MAX(area->x1, span_start[y]);
+            lv_coord_t xe = LV_MIN(area->x2, span_end[y]);
+            if (xs > xe) {
+                continue;
+            }
+            lv_area_set(&segments[n].area, xs, y, xe, y);
+            segments[n].px = px + (uint32_t)(y - area->y1) * w + (xs - area->x1);
+            n++;
+        }
+        return n;
+    }
+
+    // Pack the box's rows back to back; the destination never overtakes the source
+    lv_coord_t bw  = lv_area_get_width(&box);
+    uint16_t  *dst = px;
+    for (lv_coord_t y = box.y1; y <= box.y2; y++) {
+        memmove(dst, px + (uint32_t)(y - area->y1) * w + (box.x1 - area->x1), bw * sizeof(uint16_t));
+        dst += bw;
+    }
+    segments[0].area = box;
+    segments[0].px   = px;
+    return 1;
+}
+#endif
+
+// -------------------------------------------------------------------------
+// LVGL Display flush function
+// -------------------------------------------------------------------------
+#if LVGL_VERSION_MAJOR == 9
+void xiao_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+#elif LVGL_VERSION_MAJOR == 8
+void xiao_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+#endif
+{
+    if (poll_cb) {
+        poll_cb();
+    }
+    uint32_t start = micros();
+
+#if LVGL_VERSION_MAJOR == 9
+    uint16_t *px_buf = (uint16_t *)px_map;
+#else
+    uint16_t *px_buf = (uint16_t *)&color_p->full;
+#endif
+
+#if LVGL_ROUND_CLIP
+    uint16_t count = clip_to_circle(area, px_buf);
+#else
+    segments[0].area = *area;
+    segments[0].px   = px_buf;
+    uint16_t count = 1;
+#endif
+
+    uint32_t sent_px = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        sent_px += lv_area_get_size(&segments[i].area);
+    }
+    flush_stats.flushes++;
+    flush_stats.bytes       += sent_px * sizeof(uint16_t);
+    flush_stats.bytes_saved += (lv_area_get_size(area) - sent_px) * sizeof(uint16_t);
+    flush_stats.windows     += count;
+
+    // LVGL only hands over a buffer after xiao_disp_wait() gave the previous
+    // one back, so the bus is idle here
+    if (count > 0) {
+        xiao_bus_write_async(segments, count);
+    } else {
+        flush_stats.strips_skipped++;
+    }
+
+#if !LVGL_DMA_FLUSH
+    while (!xiao_bus_done()) {
+    }
+#endif
+    flush_stats.flush_us += micros() - start;
+
+#if !LVGL_DMA_FLUSH
+#if LVGL_VERSION_MAJOR == 9
+    lv_display_flush_ready(disp);
+#else
+    lv_disp_flush_ready(disp);
+#endif
+#endif
+    // otherwise flush_ready comes from xiao_disp_wait() once the strip is out
+}
+
+// -------------------------------------------------------------------------
+// Called by LVGL when it needs the buffer that is on the bus back
+// -------------------------------------------------------------------------
+#if LVGL_DMA_FLUSH
+#if LVGL_VERSION_MAJOR == 9
+static void xiao_disp_wait(lv_display_t *disp)
+#elif LVGL_VERSION_MAJOR == 8
+static void xiao_disp_wait(lv_disp_drv_t *disp)
+#endif
+{
+    if (poll_cb) {
+        poll_cb();
+    }
+    uint32_t start = micros();
+    while (!xiao_bus_done()) {
+    }
+    flush_stats.wait_us += micros() - start;
+    flush_stats.waits++;
+
+#if LVGL_VERSION_MAJOR == 9
+    lv_display_flush_ready(disp);
+#else
+    lv_disp_flush_ready(disp);
+#endif
+}
+#endif
+
+// -------------------------------------------------------------------------
+// Draw buffers
+// -------------------------------------------------------------------------
+#if LVGL_VERSION_MAJOR == 9
+static lv_display_t *xiao_disp = NULL;
+#elif LVGL_VERSION_MAJOR == 8
+static lv_disp_draw_buf_t draw_buf;
+static lv_disp_drv_t      disp_drv;
+#endif
+
+// The LVGL_BUFF_SIZE row boot buffers are the caller's (or taken from the heap
+// once); taller buffers come from the heap when asked for and go back to it
+// when the size drops again
+static uint8_t *boot_buf    = NULL;
+static uint8_t *boot_buf2   = NULL;
+static uint8_t *heap_buf    = NULL;
+static uint8_t *heap_buf2   = NULL;
+static uint16_t buffer_rows = 0;
+
+static void apply_buffers(void *buf1, void *buf2, uint16_t rows)
+{
+    uint32_t px_count = (uint32_t)SCREEN_WIDTH * rows;
+
+#if LVGL_VERSION_MAJOR == 9
+    lv_display_set_buffers(xiao_disp, buf1, buf2, px_count * LV_XIAO_PX_BYTES, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#elif LVGL_VERSION_MAJOR == 8
+    lv_disp_draw_buf_init(&draw_buf, buf1, buf2, px_count);
+#endif
+    buffer_rows = rows;
+}
+
+void lv_xiao_disp_use_buffers(void *buf1, void *buf2)
+{
+    boot_buf  = (uint8_t *)buf1;
+#if LVGL_DMA_FLUSH
+    boot_buf2 = (uint8_t *)buf2;
+#endif
+}
+
+static void alloc_boot_buffers(void)
+{
+    if (!boot_buf) {
+        boot_buf = (uint8_t *)buf_alloc(LV_XIAO_DRAW_BUF_BYTES);
+#if LVGL_DMA_FLUSH
+        boot_buf2 = boot_buf ? (uint8_t *)buf_alloc(LV_XIAO_DRAW_BUF_BYTES) : NULL;
+#endif
+    }
+}
+
+// -------------------------------------------------------------------------
+// Set up the LVGL display driver
+// -------------------------------------------------------------------------
+void lv_xiao_disp_register(void)
+{
+#if LVGL_ROUND_CLIP
+    build_spans();
+#endif
+
+#if LVGL_VERSION_MAJOR == 9
+    xiao_disp = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
+    lv_display_set_flush_cb(xiao_disp, xiao_disp_flush);
+#if LVGL_DMA_FLUSH
+    lv_display_set_flush_wait_cb(xiao_disp, xiao_disp_wait);
+#endif
+    // Buffers for partial updating
+    alloc_boot_buffers();
+    apply_buffers(boot_buf, boot_buf2, LVGL_BUFF_SIZE);
+
+#elif LVGL_VERSION_MAJOR == 8
+    // Buffers for partial updating
+    alloc_boot_buffers();
+    apply_buffers(boot_buf, boot_buf2, LVGL_BUFF_SIZE);
+
+    // Initialize the display driver for LVGL
+    lv_disp_drv_init(&disp_drv);
+    disp_drv.hor_res = SCREEN_WIDTH;
+    disp_drv.ver_res = SCREEN_HEIGHT;
+    disp_drv.flush_cb = xiao_disp_flush;
+#if LVGL_DMA_FLUSH
+    disp_drv.wait_cb = xiao_disp_wait;
+#endif
+    disp_drv.draw_buf = &draw_buf;
+    lv_disp_drv_register(&disp_drv);
+#endif
+}
+
+void lv_xiao_disp_set_poll_cb(void (*cb)(void))
+{
+    poll_cb = cb;
+}
+
+void lv_xiao_disp_set_allocator(void *(*alloc)(size_t bytes), void (*release)(void *ptr))
+{
+    buf_alloc   = alloc ? alloc : malloc;
+    buf_release = release ? release : free;
+}
+
+void lv_xiao_disp_sync(void)
+{
+    while (!xiao_bus_done()) {
+    }
+
+    // Harmless when LVGL wasn't waiting on a flush
+#if LVGL_VERSION_MAJOR == 9
+    lv_display_flush_ready(xiao_disp);
+#elif LVGL_VERSION_MAJOR == 8
+    lv_disp_flush_ready(&disp_drv);
+#endif
+}
+
+uint16_t lv_xiao_disp_set_buffer_rows(uint16_t rows)
+{
+    if (rows < 1) {
+        rows = 1;
+    }
+    if (rows > SCREEN_HEIGHT) {
+        rows = SCREEN_HEIGHT;
+    }
+    if (rows == buffer_rows) {
+        return buffer_rows;
+    }
+
+    // Nothing of the old buffers may still be on the bus
+    lv_xiao_disp_sync();
+
+    buf_release(heap_buf);
+    buf_release(heap_buf2);
+    heap_buf  = NULL;
+    heap_buf2 = NULL;
+
+    if (rows <= LVGL_BUFF_SIZE) {
+        apply_buffers(boot_buf, boot_buf2, rows);
+    } else {
+        size_t bytes = (size_t)SCREEN_WIDTH * rows * LV_XIAO_PX_BYTES;
+        heap_buf = (uint8_t *)buf_alloc(bytes);
+#if LVGL_DMA_FLUSH
+        // A full frame often only fits once; single buffering still works
+        heap_buf2 = heap_buf ? (uint8_t *)buf_alloc(bytes) : NULL;
+#endif
+        if (heap_buf) {
+            apply_buffers(heap_buf, heap_buf2, rows);
+        } else {
+            apply_buffers(boot_buf, boot_buf2, LVGL_BUFF_SIZE);
+        }
+    }
+
+    xiao_flush_stats_reset();
+#if LVGL_VERSION_MAJOR == 9
+    lv_obj_invalidate(lv_screen_active());
+#else
+    lv_obj_invalidate(lv_scr_act());
+#endif
+    return buffer_rows;
+}
+
+uint16_t lv_xiao_disp_buffer_rows(void)
+{
+    return buffer_rows;
+}
+
+bool lv_xiao_disp_double_buffered(void)
+{
+    return (buffer_rows <= LVGL_BUFF_SIZE ? boot_buf2 : heap_buf2) != NULL;
+}
+
+// -------------------------------------------------------------------------
+// Stats
+// -------------------------------------------------------------------------
+const xiao_flush_stats_t *xiao_flush_stats(void)
+{
+    return &flush_stats;
+}
+
+void xiao_flush_stats_reset(void)
+{
+    memset(&flush_stats, 0, sizeof(flush_stats));
+}
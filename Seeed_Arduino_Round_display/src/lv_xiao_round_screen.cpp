@@ -32,47 +32,147 @@ Arduino_DataBus *bus = new Arduino_RPiPicoSPI(XIAO_DC, XIAO_CS, SCK, MOSI, MISO,
 Arduino_DataBus *bus = new Arduino_HWSPI(XIAO_DC, XIAO_CS);
 #endif
 
-Arduino_GFX *gfx = new Arduino_GC9A01(bus, -1, screen_rotation, true);
+Arduino_GC9A01 *gfx = new Arduino_GC9A01(bus, -1, screen_rotation, true);
 
 #else
 #error "Please define a graphics library for display (TFT_eSPI or Arduino_GFX)."
 #endif
 
 // -------------------------------------------------------------------------
-// LVGL Display flush function
+// Pixel bus
 // -------------------------------------------------------------------------
-#if LVGL_VERSION_MAJOR == 9
-void xiao_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
-#elif LVGL_VERSION_MAJOR == 8
-void xiao_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color_p)
+#if LVGL_DMA_FLUSH && defined(USE_ARDUINO_GFX_LIBRARY) && \
+    (defined(ARDUINO_Seeed_XIAO_nRF52840_Sense) || defined(ARDUINO_Seeed_XIAO_nRF52840))
+
+// SPIM instance Arduino_NRFXSPI drives (SPIM3 is the only one above 8 MHz).
+// Arduino_GFX sets the address window in blocking mode, then the strip goes
+// out through EasyDMA on the same, already configured peripheral.
+#ifndef XIAO_DMA_SPIM
+#define XIAO_DMA_SPIM NRF_SPIM3
 #endif
+#define XIAO_DMA_MAX_BYTES 0xFFFE  // TXD.MAXCNT is 16 bits
+
+static const xiao_segment_t *dma_segs  = NULL;
+static uint16_t              dma_count = 0;
+static uint16_t              dma_seg   = 0;
+static const uint8_t        *dma_next  = NULL;
+static uint32_t              dma_left  = 0;
+static bool                  dma_busy  = false;
+
+static void dma_kick(void)
 {
-    uint32_t w = (area->x2 - area->x1 + 1);
-    uint32_t h = (area->y2 - area->y1 + 1);
+    uint32_t n = dma_left < XIAO_DMA_MAX_BYTES ? dma_left : XIAO_DMA_MAX_BYTES;
 
-#if LVGL_VERSION_MAJOR == 9
-    uint16_t *px_buf = (uint16_t *)px_map;
+    XIAO_DMA_SPIM->TXD.PTR    = (uint32_t)dma_next;
+    XIAO_DMA_SPIM->TXD.MAXCNT = n;
+    XIAO_DMA_SPIM->RXD.MAXCNT = 0;
+    XIAO_DMA_SPIM->EVENTS_END = 0;
+    XIAO_DMA_SPIM->TASKS_START = 1;
+
+    dma_next += n;
+    dma_left -= n;
+}
+
+// Address window in blocking mode, then the pixels through EasyDMA
+static void dma_start_segment(void)
+{
+    const xiao_segment_t *seg = &dma_segs[dma_seg];
+    gfx->writeAddrWindow(seg->area.x1, seg->area.y1,
+                         seg->area.x2 - seg->area.x1 + 1, seg->area.y2 - seg->area.y1 + 1);
+
+    dma_next = (const uint8_t *)seg->px;
+    dma_left = lv_area_get_size(&seg->area) * sizeof(uint16_t);
+    dma_kick();
+}
+
+void xiao_bus_begin(void)
+{
+    dma_busy = false;
+}
+
+void xiao_bus_write_async(const xiao_segment_t *segments, uint16_t count)
+{
+#if LVGL_VERSION_MAJOR == 8 && LV_COLOR_16_SWAP
+    // already big-endian on the wire
 #else
-    uint16_t *px_buf = (uint16_t *)&color_p->full;
+    // The panel wants RGB565 MSB first; the buffer is LVGL's to overwrite
+    for (uint16_t s = 0; s < count; s++) {
+        uint16_t *px = segments[s].px;
+        uint32_t  n  = lv_area_get_size(&segments[s].area);
+        for (uint32_t i = 0; i < n; i++) {
+            px[i] = (px[i] >> 8) | (px[i] << 8);
+        }
+    }
 #endif
 
+    dma_segs  = segments;
+    dma_count = count;
+    dma_seg   = 0;
+    dma_busy  = true;
+
+    gfx->startWrite();
+    dma_start_segment();
+}
+
+bool xiao_bus_done(void)
+{
+    if (!dma_busy) {
+        return true;
+    }
+    if (!XIAO_DMA_SPIM->EVENTS_END) {
+        return false;
+    }
+    XIAO_DMA_SPIM->EVENTS_END = 0;
+
+    // Segments above 64 KB go out in several chunks
+    if (dma_left) {
+        dma_kick();
+        return false;
+    }
+    if (++dma_seg < dma_count) {
+        dma_start_segment();
+        return false;
+    }
+
+    dma_busy = false;
+    gfx->endWrite();
+    return true;
+}
+
+#else
+
+// Blocking fallback: the strip is out by the time the write returns
+void xiao_bus_begin(void)
+{
+}
+
+void xiao_bus_write_async(const xiao_segment_t *segments, uint16_t count)
+{
+    for (uint16_t s = 0; s < count; s++) {
+        const lv_area_t *area = &segments[s].area;
+        uint16_t        *px   = segments[s].px;
+        uint32_t w = (area->x2 - area->x1 + 1);
+        uint32_t h = (area->y2 - area->y1 + 1);
+
 #if defined(USE_TFT_ESPI_LIBRARY)
-    tft.startWrite();
-    tft.setAddrWindow(area->x1, area->y1, w, h);
-    tft.pushColors(px_buf, w * h, true);
-    tft.endWrite();
+        tft.startWrite();
+        tft.setAddrWindow(area->x1, area->y1, w, h);
+        tft.pushColors(px, w * h, true);
+        tft.endWrite();
 
 #elif defined(USE_ARDUINO_GFX_LIBRARY)
-    gfx->draw16bitRGBBitmap(area->x1, area->y1, px_buf, w, h);
+        gfx->draw16bitRGBBitmap(area->x1, area->y1, px, w, h);
 #endif
+    }
+}
 
-#if LVGL_VERSION_MAJOR == 9
-    lv_display_flush_ready(disp);
-#else
-    lv_disp_flush_ready(disp);
-#endif
+bool xiao_bus_done(void)
+{
+    return true;
 }
 
+#endif
+
 // -------------------------------------------------------------------------
 // Initialize the display hardware
 // -------------------------------------------------------------------------
@@ -100,29 +200,10 @@ void xiao_disp_init(void)
 void lv_xiao_disp_init(void)
 {
     xiao_disp_init();
+    xiao_bus_begin();
 
-#if LVGL_VERSION_MAJOR == 9
-    // Create buffer for partial updating
-    static uint8_t draw_buf[SCREEN_WIDTH * LVGL_BUFF_SIZE * LV_COLOR_DEPTH / 8];
-    lv_display_t *disp = lv_display_create(SCREEN_WIDTH, SCREEN_HEIGHT);
-    lv_display_set_flush_cb(disp, xiao_disp_flush);
-    lv_display_set_buffers(disp, (void *)draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
-
-#elif LVGL_VERSION_MAJOR == 8
-    // Create a buffer for partial updating
-    static lv_disp_draw_buf_t draw_buf;
-    static lv_color_t buf[SCREEN_WIDTH * LVGL_BUFF_SIZE];
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, SCREEN_WIDTH * LVGL_BUFF_SIZE);
-
-    // Initialize the display driver for LVGL
-    static lv_disp_drv_t disp_drv;
-    lv_disp_drv_init(&disp_drv);
-    disp_drv.hor_res = SCREEN_WIDTH;
-    disp_drv.ver_res = SCREEN_HEIGHT;
-    disp_drv.flush_cb = xiao_disp_flush;
-    disp_drv.draw_buf = &draw_buf;
-    lv_disp_drv_register(&disp_drv);
-#endif
+    // Draw buffers and flush / wait callbacks live in lv_xiao_flush.cpp
+    lv_xiao_disp_register();
 }
 
 // -------------------------------------------------------------------------
@@ -140,6 +221,11 @@ bool chsc6x_is_pressed(void)
     return true;
 }
 
+bool chsc6x_int_active(void)
+{
+    return digitalRead(TOUCH_INT) == LOW;
+}
+
 void chsc6x_convert_xy(uint8_t *x, uint8_t *y)
 {
     uint8_t x_tmp = *x, y_tmp = *y, _end = 0;
@@ -153,19 +239,29 @@ void chsc6x_convert_xy(uint8_t *x, uint8_t *y)
     }
 }
 
-void chsc6x_get_xy(lv_coord_t * x, lv_coord_t * y)
+bool chsc6x_read_point(lv_coord_t *x, lv_coord_t *y, bool *touched)
 {
     uint8_t temp[CHSC6X_READ_POINT_LEN] = {0};
     uint8_t read_len = Wire.requestFrom(CHSC6X_I2C_ID, CHSC6X_READ_POINT_LEN);
-    if(read_len == CHSC6X_READ_POINT_LEN){
-        Wire.readBytes(temp, read_len);
-        // 0x01 means valid data
-        if (temp[0] == 0x01) {
-            chsc6x_convert_xy(&temp[2], &temp[4]);
-            *x = temp[2];
-            *y = temp[4];
-        }
+    if (read_len != CHSC6X_READ_POINT_LEN) {
+        return false;
+    }
+    Wire.readBytes(temp, read_len);
+
+    // 0x01 means valid data
+    *touched = (temp[0] == 0x01);
+    if (*touched) {
+        chsc6x_convert_xy(&temp[2], &temp[4]);
+        *x = temp[2];
+        *y = temp[4];
     }
+    return true;
+}
+
+void chsc6x_get_xy(lv_coord_t * x, lv_coord_t * y)
+{
+    bool touched;
+    chsc6x_read_point(x, y, &touched);
 }
 
 #if LVGL_VERSION_MAJOR == 9
@@ -185,6 +281,8 @@ void chsc6x_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
     }
 }
 
+static lv_indev_t *touch_indev = NULL;
+
 void lv_xiao_touch_init(void)
 {
     pinMode(TOUCH_INT, INPUT_PULLUP);
@@ -194,11 +292,17 @@ void lv_xiao_touch_init(void)
     lv_indev_t *indev = lv_indev_create();
     lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
     lv_indev_set_read_cb(indev, chsc6x_read);
+    touch_indev = indev;
 #elif LVGL_VERSION_MAJOR == 8
     static lv_indev_drv_t indev_drv;
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = chsc6x_read;
-    lv_indev_drv_register(&indev_drv);
+    touch_indev = lv_indev_drv_register(&indev_drv);
 #endif
 }
+
+lv_indev_t *lv_xiao_touch_indev(void)
+{
+    return touch_indev;
+}
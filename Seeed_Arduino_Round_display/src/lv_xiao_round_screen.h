@@ -16,7 +16,14 @@
 // Screen parameters
 #define SCREEN_WIDTH    240
 #define SCREEN_HEIGHT   240
-#define LVGL_BUFF_SIZE  10   // Number of rows in LVGL draw buffer
+#ifndef LVGL_BUFF_SIZE
+#define LVGL_BUFF_SIZE  10   // Rows per LVGL draw buffer at boot
+#endif
+
+// Two draw buffers: LVGL renders strip N+1 while strip N is on the wire
+#ifndef LVGL_DMA_FLUSH
+#define LVGL_DMA_FLUSH  1
+#endif
 
 // I2C capacitive touch driver
 #define CHSC6X_I2C_ID          0x2e
@@ -54,16 +61,105 @@ void xiao_disp_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *col
 #error "Not supported LVGL version (only v8 or v9)."
 #endif
 
+#if LVGL_VERSION_MAJOR == 9
+#define LV_XIAO_PX_BYTES (LV_COLOR_DEPTH / 8)
+#else
+#define LV_XIAO_PX_BYTES sizeof(lv_color_t)
+#endif
+
+// One boot draw buffer, LVGL_BUFF_SIZE rows
+#define LV_XIAO_DRAW_BUF_BYTES (SCREEN_WIDTH * LVGL_BUFF_SIZE * LV_XIAO_PX_BYTES)
+
 void xiao_disp_init(void);
+
+/*
+  Hands the driver its boot draw buffers, LV_XIAO_DRAW_BUF_BYTES each and at
+  least 4-byte aligned; buf2 is ignored without LVGL_DMA_FLUSH. Call before
+  lv_xiao_disp_init(). Without it the driver takes them from the heap once.
+*/
+void lv_xiao_disp_use_buffers(void *buf1, void *buf2);
+void lv_xiao_disp_register(void);
 void lv_xiao_disp_init(void);
 
+// Waits until nothing is on the bus and LVGL owns both buffers again
+void lv_xiao_disp_sync(void);
+
+/*
+  Called before every strip flush and every wait for the bus, so every few ms
+  while a frame renders; for input that shouldn't wait for the next loop()
+  pass. Keep it short. NULL removes it.
+*/
+void lv_xiao_disp_set_poll_cb(void (*cb)(void));
+
+/*
+  Allocator for draw buffers the driver takes from the heap: the boot buffers
+  when none were handed over, and taller ones from set_buffer_rows(). Default
+  malloc / free; NULL restores either. Call before lv_xiao_disp_init().
+*/
+void lv_xiao_disp_set_allocator(void *(*alloc)(size_t bytes), void (*release)(void *ptr));
+
+/*
+  Draw buffer height at runtime: 10/20/40/80 rows, SCREEN_HEIGHT for a full
+  frame. Anything above LVGL_BUFF_SIZE is taken from the heap; if the second
+  buffer doesn't fit it runs single buffered, if neither does it falls back to
+  the boot buffers. Returns the rows now in use and resets the flush stats.
+*/
+uint16_t lv_xiao_disp_set_buffer_rows(uint16_t rows);
+uint16_t lv_xiao_disp_buffer_rows(void);
+bool     lv_xiao_disp_double_buffered(void);
+
+/*------------------------------------------------------------------------------
+ *  Pixel bus under xiao_disp_flush()
+ *
+ *  xiao_bus_write_async() starts sending a list of rectangles, each with its
+ *  pixels back to back, and may return before they are out; the pixels and
+ *  the list must stay untouched until xiao_bus_done() returns true. nRF52840
+ *  uses SPIM EasyDMA, other boards a blocking write that is already done on
+ *  return, host/ a stand-in that simulates wire time.
+ *-----------------------------------------------------------------------------*/
+typedef struct {
+    lv_area_t  area;
+    uint16_t  *px;       // lv_area_get_size(&area) pixels, row after row
+} xiao_segment_t;
+
+// CASET + RASET + RAMWR framing the panel needs for every rectangle
+#define XIAO_WINDOW_BYTES 11
+
+void xiao_bus_begin(void);
+void xiao_bus_write_async(const xiao_segment_t *segments, uint16_t count);
+bool xiao_bus_done(void);
+
+// Skip the corners of each strip that fall outside the round panel
+#ifndef LVGL_ROUND_CLIP
+#define LVGL_ROUND_CLIP 1
+#endif
+
+typedef struct {
+    uint32_t flushes;        // strips LVGL handed over
+    uint32_t bytes;          // pixel bytes actually sent
+    uint32_t bytes_saved;    // pixel bytes of those strips that were invisible
+    uint32_t windows;        // rectangles sent (each costs XIAO_WINDOW_BYTES)
+    uint32_t strips_skipped; // strips with nothing visible, not sent at all
+    uint32_t waits;          // times LVGL needed a buffer back
+    uint32_t wait_us;        // time spent blocked on the bus in those waits
+    uint32_t flush_us;       // time spent in the flush callback itself (clip + bus start)
+} xiao_flush_stats_t;
+
+const xiao_flush_stats_t *xiao_flush_stats(void);
+void xiao_flush_stats_reset(void);
+
 /*------------------------------------------------------------------------------
  *  TOUCH DRIVER (chsc6x) Prototypes
  *-----------------------------------------------------------------------------*/
 bool chsc6x_is_pressed(void);
+bool chsc6x_int_active(void);   // TOUCH_INT level right now, no debounce delay
 void chsc6x_convert_xy(uint8_t *x, uint8_t *y);
 void chsc6x_get_xy(lv_coord_t *x, lv_coord_t *y);
 
+// One report read: false if the I2C read failed, otherwise *touched tells
+// whether the report carries a point (x/y are only written if it does)
+bool chsc6x_read_point(lv_coord_t *x, lv_coord_t *y, bool *touched);
+
 #if LVGL_VERSION_MAJOR == 9
 void chsc6x_read(lv_indev_t *indev, lv_indev_data_t *data);
 #elif LVGL_VERSION_MAJOR == 8
@@ -72,4 +168,7 @@ void chsc6x_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data);
 
 void lv_xiao_touch_init(void);
 
+// The pointer input device lv_xiao_touch_init() registered
+lv_indev_t *lv_xiao_touch_indev(void);
+
 #endif // LV_XIAO_ROUND_SCREEN_H
@@ -0,0 +1,56 @@
+#ifndef ANIM_OFFSETS_H
+#define ANIM_OFFSETS_H
+
+#include <stdint.h>
+#include "trig_lut.h"
+
+/*
+  Per-layer offsets the sprite exec callbacks (pet_anim, item_anim,
+  rotate_anim) apply at angle v, in decidegrees. Integer only, from the Q15
+  table, and free of LVGL so host/trig_bench can compare them with the float
+  expressions they replaced.
+*/
+
+// Pivot bob of a pet layer: sin(v) * index / 4 px, truncated toward zero
+static inline int32_t pet_pivot_offset(uint16_t sprite_index, int32_t v)
+{
+    return (int32_t)trig_sin_q15(v) * sprite_index / (4 * TRIG_Q15_ONE);
+}
+
+// (1 + 1.2 * index) * 2 px of lift per layer, rounded up like the float version truncated
+static inline int32_t pet_layer_rise(uint16_t sprite_index)
+{
+    return 2 + (24 * sprite_index + 9) / 10;
+}
+
+static inline int32_t item_layer_rise(uint16_t sprite_index, int32_t v)
+{
+    // Ensure v wraps around every full rotation
+    int32_t wrapped_v = v % TRIG_TURN; // Always between 0 and 3600
+
+    // ENTIRE STACK RISE/FALL (Positive Only)
+    // Sin wave shifted and scaled to [0, 10] px
+    const int32_t amplitude_rise = 10;
+    int32_t entire_stack_offset = ((int32_t)trig_sin_q15(wrapped_v) + TRIG_Q15_ONE) * amplitude_rise
+                                / (2 * TRIG_Q15_ONE);
+
+    // PER-LAYER OFFSET
+    // Half a sine wave per turn, already in [0, 1]; odd angles take the
+    // midpoint of the two neighbouring half-angle entries
+    const int32_t amplitude_layer = 3;
+    const int32_t baseline_offset = 2;   // Offset layers at the start and end
+    int32_t wave = ((int32_t)trig_sin_q15(wrapped_v / 2) + trig_sin_q15((wrapped_v + 1) / 2)) / 2;
+    int32_t layer_offset = baseline_offset * sprite_index
+                         + wave * amplitude_layer * sprite_index / TRIG_Q15_ONE;
+
+    return entire_stack_offset + layer_offset;
+}
+
+// rotate_anim only stacks the layers, one pixel apart
+static inline int32_t rotate_layer_rise(uint16_t sprite_index)
+{
+    const int32_t baseline_offset = 1;
+    return baseline_offset * sprite_index;
+}
+
+#endif // ANIM_OFFSETS_H
@@ -1,154 +1,300 @@
 #include "animations.h"
-#include "touch_swipe.h"
+#include "touch_gesture.h"
+#include "event_log.h"
+#include "profiler.h"
 #include "touch_sensor_functions.h"
+#include "sprite_cache.h"
 
-#define MAX_SPRITES 20
+// One per sprite array, claimed the first time stack_anim() sees it
+static stack_anim_driver_t drivers[STACK_ANIM_MAX_DRIVERS];
+static uint8_t             driver_count = 0;
 
-// This function applied all animations to all layers of a sprite-stack
-void stack_anim(
+static stack_anim_driver_t *driver_for(pivot_sprite_t *sprites)
+{
+    for (uint8_t i = 0; i < driver_count; i++) {
+        if (drivers[i].sprites == sprites) {
+            return &drivers[i];
+        }
+    }
+    if (driver_count >= STACK_ANIM_MAX_DRIVERS) {
+        return NULL;
+    }
+    stack_anim_driver_t *driver = &drivers[driver_count++];
+    driver->sprites = sprites;
+    return driver;
+}
+
+//----------------------- Union invalidation ------------------------
+
+#if LVGL_VERSION_MAJOR == 9
+#define obj_display(obj)           lv_obj_get_display(obj)
+#define obj_ext_draw_size(obj)     lv_obj_get_ext_draw_size(obj)
+#define display_invalidation(d, e) lv_display_enable_invalidation(d, e)
+#else
+#define obj_display(obj)           lv_obj_get_disp(obj)
+#define obj_ext_draw_size(obj)     _lv_obj_get_ext_draw_size(obj)
+#define display_invalidation(d, e) lv_disp_enable_invalidation(d, e)
+#endif
+
+static stack_inval_stats_t inval_stats;
+static uint32_t            frame_layer_px = 0;
+static uint32_t            frame_union_px = 0;
+
+void stack_inval_begin(stack_inval_t *inval)
+{
+    inval->valid  = false;
+    inval->screen = NULL;
+#if STACK_ANIM_UNION_INVALIDATE
+    display_invalidation(NULL, false);   // NULL = default display
+#endif
+}
+
+void stack_inval_add(stack_inval_t *inval, lv_obj_t *obj)
+{
+    if (lv_obj_has_flag(obj, LV_OBJ_FLAG_HIDDEN)) {
+        return;
+    }
+
+    // What lv_obj_invalidate() would mark: the coords plus the overhang a
+    // rotated image draws outside them
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    lv_coord_t ext = obj_ext_draw_size(obj);
+    lv_area_increase(&area, ext, ext);
+    frame_layer_px += lv_area_get_size(&area);
+
+    if (inval->valid) {
+        _lv_area_join(&inval->area, &inval->area, &area);
+    } else {
+        inval->area   = area;
+        inval->valid  = true;
+        inval->screen = lv_obj_get_screen(obj);
+    }
+}
+
+void stack_inval_layout(lv_obj_t *obj)
+{
+    // Lays out the whole screen, but only objects marked dirty are touched
+    lv_obj_update_layout(obj);
+}
+
+void stack_inval_end(stack_inval_t *inval)
+{
+    inval_stats.updates++;
+#if STACK_ANIM_UNION_INVALIDATE
+    display_invalidation(NULL, true);
+    if (inval->valid) {
+        frame_union_px += lv_area_get_size(&inval->area);
+        lv_obj_invalidate_area(inval->screen, &inval->area);
+    }
+#else
+    (void)inval;
+#endif
+}
+
+void stack_inval_frame_end(void)
+{
+#if !STACK_ANIM_UNION_INVALIDATE
+    frame_union_px = frame_layer_px;   // every object invalidated its own boxes
+#endif
+    inval_stats.frames++;
+    inval_stats.layer_px          += frame_layer_px;
+    inval_stats.union_px          += frame_union_px;
+    inval_stats.frame_layer_px     = frame_layer_px;
+    inval_stats.frame_union_px     = frame_union_px;
+    inval_stats.max_frame_union_px = LV_MAX(inval_stats.max_frame_union_px, frame_union_px);
+    frame_layer_px = 0;
+    frame_union_px = 0;
+}
+
+const stack_inval_stats_t *stack_inval_stats(void)
+{
+    return &inval_stats;
+}
+
+void stack_inval_stats_reset(void)
+{
+    memset(&inval_stats, 0, sizeof(inval_stats));
+    frame_layer_px = 0;
+    frame_union_px = 0;
+}
+
+//----------------------- Stack driver ------------------------
+
+// The one exec callback LVGL calls per stack and tick
+static void stack_anim_exec(void *var, int32_t v)
+{
+    PROF_SCOPE(PROF_SPRITE_EXEC);
+    stack_anim_driver_t *driver  = (stack_anim_driver_t *)var;
+    pivot_sprite_t      *layers  = driver->sprites;
+    sprite_exec_cb_t     exec_cb = driver->exec_cb;
+    uint16_t             count   = driver->sprite_count;
+
+    // Composited stacks only record poses; the compositor invalidates its image
+    if (count == 0 || layers[0].stack) {
+        for (uint16_t i = 0; i < count; i++) {
+            exec_cb(&layers[i], v);
+        }
+        return;
+    }
+
+    stack_inval_t inval;
+    stack_inval_begin(&inval);
+    for (uint16_t i = 0; i < count; i++) {
+        stack_inval_add(&inval, layers[i].obj);
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        exec_cb(&layers[i], v);
+    }
+    // lv_obj_set_pos() only marks the layout dirty; move the objects now, while
+    // their own invalidations are suppressed, so the second pass sees the new coords
+    stack_inval_layout(layers[0].obj);
+    for (uint16_t i = 0; i < count; i++) {
+        stack_inval_add(&inval, layers[i].obj);
+    }
+    stack_inval_end(&inval);
+}
+
+// This function applies one animation to all layers of a sprite-stack
+void stack_anim_ex(
     pivot_sprite_t    *sprites,
     uint16_t           sprite_count,
     int32_t           *current_angle,
     int32_t            end_angle_offset,
     uint32_t           duration,
     bool               infinite,
-    sprite_exec_cb_t   exec_cb  // e.g. pet_anim
+    sprite_exec_cb_t   exec_cb,
+    lv_anim_ready_cb_t ready_cb
 )
 {
     int32_t start_angle = *current_angle;
     int32_t end_angle   = start_angle + end_angle_offset;
 
-    // Static to avoid going out of scope (or you can make it global)
-    static lv_anim_t local_anim_storage[MAX_SPRITES];
-
-    // For each sprite in the stack...
-    for (uint16_t i = 0; i < sprite_count && i < MAX_SPRITES; i++) {
-
-        // Stop any ongoing animations on this sprite
-        lv_anim_del(sprites[i].obj, NULL);
-
-        // Initialize an animation
-        lv_anim_init(&local_anim_storage[i]);
-
-        // "var" is the pivot_sprite_t pointer for this layer
-        lv_anim_set_var(&local_anim_storage[i], &sprites[i]);
-        // This is the CRUCIAL part:
-        lv_anim_set_exec_cb(&local_anim_storage[i], exec_cb);
-
-        lv_anim_set_time(&local_anim_storage[i], duration);
-        lv_anim_set_values(&local_anim_storage[i], start_angle, end_angle);
-        if (infinite) {
-            lv_anim_set_repeat_count(&local_anim_storage[i], LV_ANIM_REPEAT_INFINITE);
-        }
+    stack_anim_driver_t *driver = driver_for(sprites);
+    if (!driver) {
+        LOG_WARN(LOG_EV_ANIM_NO_DRIVER, STACK_ANIM_MAX_DRIVERS);
+        return;
+    }
 
-        // Kick it off
-        lv_anim_start(&local_anim_storage[i]);
+    // Stop whatever the stack was doing before
+    lv_anim_del(driver, NULL);
+    driver->sprite_count = LV_MIN(sprite_count, STACK_ANIM_MAX_LAYERS);
+    driver->exec_cb      = exec_cb;
+
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, driver);
+    lv_anim_set_exec_cb(&anim, stack_anim_exec);
+    lv_anim_set_time(&anim, duration);
+    lv_anim_set_values(&anim, start_angle, end_angle);
+    if (infinite) {
+        lv_anim_set_repeat_count(&anim, LV_ANIM_REPEAT_INFINITE);
+    } else if (ready_cb) {
+        lv_anim_set_ready_cb(&anim, ready_cb);
     }
 
+    // LVGL copies the descriptor
+    lv_anim_start(&anim);
+
     // Update angle for next time (optional)
     *current_angle = end_angle;
 }
 
+void stack_anim(
+    pivot_sprite_t    *sprites,
+    uint16_t           sprite_count,
+    int32_t           *current_angle,
+    int32_t            end_angle_offset,
+    uint32_t           duration,
+    bool               infinite,
+    sprite_exec_cb_t   exec_cb  // e.g. pet_anim
+)
+{
+    stack_anim_ex(sprites, sprite_count, current_angle, end_angle_offset,
+                  duration, infinite, exec_cb, NULL);
+}
+
 //#####################################################################################
 //-------- Actual animation definitions
 //#####################################################################################
 
 void pet_anim(void * var, int32_t v) {
     pivot_sprite_t  * sq_data = (pivot_sprite_t *)var;
-    lv_obj_t        * obj     = sq_data->obj;
-
-    // Rotate the sprite
-    lv_img_set_angle(obj, v);
 
     // Get the sprite index (layer number)
     uint16_t sprite_index = sq_data->index;
 
-    // Get the image dimensions dynamically
-    const lv_img_dsc_t *img_dsc = (const lv_img_dsc_t *)lv_img_get_src(obj);
-    lv_coord_t img_width = img_dsc->header.w; // Image width
-    lv_coord_t img_height = img_dsc->header.h; // Image height
+    // Half the original layer's size (the object may show a cached frame)
+    lv_coord_t half_w = sq_data->half_w;
+    lv_coord_t half_h = sq_data->half_h;
 
-    int32_t pivot_offset_y = sinf((v / 3600.0) * M_PI * 2) * sprite_index / 4;
-    lv_img_set_pivot(obj, img_width / 2, img_height / 2 - pivot_offset_y); // Adjusted pivot
+    int32_t pivot_offset_y = pet_pivot_offset(sprite_index, v);
 
     // Position
-    lv_coord_t x_pos = sq_data->base_x - (img_width / 2);
-    float layer_multiplier = 1.0 + (sprite_index * 1.2); // increasing change in y offset
-    lv_coord_t y_pos = sq_data->base_y - (layer_multiplier * 2);
-    lv_obj_set_pos(obj, x_pos, y_pos);
+    lv_coord_t x_pos = sq_data->base_x - half_w;
+    lv_coord_t y_pos = sq_data->base_y - pet_layer_rise(sprite_index);
+
+    // Rotate the sprite about the adjusted pivot
+    sprite_layer_present(sq_data, v, half_w, half_h - pivot_offset_y, x_pos, y_pos);
+}
+
+lv_coord_t stack_anim_lift(void (*exec_cb)(void *, int32_t), uint16_t count)
+{
+    if (count == 0) {
+        return 0;
+    }
+    uint16_t top = count - 1;
+    if (exec_cb == pet_anim) {
+        // The top layer's pivot also bobs up by up to top / 4
+        return pet_layer_rise(top) - pet_layer_rise(0) + top / 4;
+    }
+    if (exec_cb == item_anim) {
+        // The whole-stack rise moves every layer alike; the per-layer part
+        // peaks at 2 + 3 px per index
+        return 5 * top;
+    }
+    if (exec_cb == rotate_anim) {
+        return rotate_layer_rise(top);
+    }
+    return 0;
 }
 
 void item_anim(void * var, int32_t v) {
     pivot_sprite_t *sq_data = (pivot_sprite_t *)var;
-    lv_obj_t       *obj     = sq_data->obj;
-
-    // 1) Spin each sprite by "v" degrees (LVGL uses 0..3600 = 0..360 deg).
-    lv_img_set_angle(obj, v);
 
-    // 2) Get sprite index (0..total_sprites-1) and total
+    // 1) Get sprite index (0..total_sprites-1)
     uint16_t sprite_index   = sq_data->index;
-    uint16_t total_sprites  = sq_data->total_sprites;
 
-    // 3) Basic image info
-    const lv_img_dsc_t *img_dsc = (const lv_img_dsc_t *)lv_img_get_src(obj);
-    lv_coord_t img_width  = img_dsc->header.w;
-    lv_coord_t img_height = img_dsc->header.h;
-
-    // Center pivot so rotation is about image center
-    lv_img_set_pivot(obj, img_width / 2, img_height / 2);
-
-    // Ensure v wraps around every full rotation to avoid precision issues
-    int32_t wrapped_v = v % 3600; // Always between 0 and 3600
-    float angle_f = wrapped_v / 3600.0f; // Normalize to [0, 1]
-
-    // ENTIRE STACK RISE/FALL (Positive Only)
-    // Sin wave shifted and scaled to [0, 1]
-    float amplitude_rise = 10.0f;
-    float entire_stack_offset = (sinf(angle_f * 2.0f * M_PI) + 1.0f) * 0.5f * amplitude_rise;
-
-    // PER-LAYER OFFSET
-    // Sin wave already in [0, 1] range; no need to shift
-    float wave = sinf(angle_f * M_PI);
-    float amplitude_layer = 3.0f;
-    float baseline_offset = 2.0f;       // Offset layers at the start and end
-    float layer_offset = baseline_offset * sprite_index + (wave * amplitude_layer * sprite_index);
+    // 2) Half the original layer's size (not a cached frame's)
+    lv_coord_t half_w = sq_data->half_w;
+    lv_coord_t half_h = sq_data->half_h;
 
     // FINAL POSITION
-    lv_coord_t x_pos = sq_data->base_x - (img_width / 2);
-    lv_coord_t y_pos = sq_data->base_y 
-                    - (lv_coord_t)entire_stack_offset 
-                    - (lv_coord_t)layer_offset;
+    lv_coord_t x_pos = sq_data->base_x - half_w;
+    lv_coord_t y_pos = sq_data->base_y - item_layer_rise(sprite_index, v);
 
-    lv_obj_set_pos(obj, x_pos, y_pos);
+    // 3) Spin each sprite by "v" degrees (LVGL uses 0..3600 = 0..360 deg)
+    //    about the image center
+    sprite_layer_present(sq_data, v, half_w, half_h, x_pos, y_pos);
 }
 
 void rotate_anim(void * var, int32_t v){
     pivot_sprite_t  * sq_data = (pivot_sprite_t *)var;
-    lv_obj_t        * obj     = sq_data->obj;
-
-    // 1) Spin each sprite by "v" degrees (LVGL uses 0..3600 = 0..360 deg).
-    lv_img_set_angle(obj, v);
 
-    // 2) Get sprite index (0..total_sprites-1) and total
+    // 1) Get sprite index (0..total_sprites-1)
     uint16_t sprite_index   = sq_data->index;
-    uint16_t total_sprites  = sq_data->total_sprites;
 
-    // 3) Basic image info
-    const lv_img_dsc_t *img_dsc = (const lv_img_dsc_t *)lv_img_get_src(obj);
-    lv_coord_t img_width  = img_dsc->header.w;
-    lv_coord_t img_height = img_dsc->header.h;
-
-    // Center pivot so rotation is about image center
-    lv_img_set_pivot(obj, img_width / 2, img_height / 2);
-
-    float baseline_offset = 1.0f;  
+    // 2) Half the original layer's size (not a cached frame's)
+    lv_coord_t half_w = sq_data->half_w;
+    lv_coord_t half_h = sq_data->half_h;
 
     // FINAL POSITION
-    lv_coord_t x_pos = sq_data->base_x - (img_width / 2);
-    lv_coord_t y_pos = sq_data->base_y 
-                    -baseline_offset* sprite_index;
+    lv_coord_t x_pos = sq_data->base_x - half_w;
+    lv_coord_t y_pos = sq_data->base_y - rotate_layer_rise(sprite_index);
 
-    lv_obj_set_pos(obj, x_pos, y_pos);
+    // 3) Spin each sprite by "v" degrees (LVGL uses 0..3600 = 0..360 deg)
+    //    about the image center
+    sprite_layer_present(sq_data, v, half_w, half_h, x_pos, y_pos);
 }
 
 //#####################################################################################
@@ -157,12 +303,7 @@ void rotate_anim(void * var, int32_t v){
 
 
 void swipe_anim(
-    int                  x_min, 
-    int                  x_max, 
-    int                  y_min, 
-    int                  y_max, 
-    int                  min_swipe_length, 
-    swipe_tracker_t     *tracker, 
+    touch_gesture_tracker_t *tracker, 
     int32_t             *current_angle,
 
     // The array of sprites and how many
@@ -185,37 +326,33 @@ void swipe_anim(
     uint32_t             duration,
     bool                 infinite
 ) {
-    // Update the swipe state based on touch inputs
-    update_swipe_state(x_min, x_max, y_min, y_max, min_swipe_length, tracker);
+    // Feed this pass's touch events to the recogniser
+    touch_gesture_update(tracker);
 
-    // Check if a swipe was detected
-    if (tracker->swipeDetected) {
-        Serial.print("Detected swipe direction: ");
-        switch (tracker->swipeDir) {
+    for (uint8_t i = 0; i < tracker->out_count; i++) {
+        const touch_gesture_t *g = &tracker->out[i];
+        if (g->type != TOUCH_GESTURE_SWIPE) {
+            continue;
+        }
+
+        LOG_INFO(LOG_EV_SWIPE, g->dir, g->vx, g->vy);
+        switch (g->dir) {
             case SWIPE_DIR_LEFT:
-                Serial.println("LEFT");
                 left_animation(sprite_array, sprite_count, current_angle, left_offset, duration, infinite);
                 break;
             case SWIPE_DIR_RIGHT:
-                Serial.println("RIGHT");
                 right_animation(sprite_array, sprite_count, current_angle, right_offset, duration, infinite);
                 break;
             case SWIPE_DIR_UP:
-                Serial.println("UP");
                 up_animation(sprite_array, sprite_count, current_angle, up_offset, duration, infinite);
                 break;
             case SWIPE_DIR_DOWN:
-                Serial.println("DOWN");
                 down_animation(sprite_array, sprite_count, current_angle, down_offset, duration, infinite);
                 break;
             default:
-                Serial.println("NONE");
                 break;
         }
-
-        tracker->swipeDetected = false; // Reset swipe detection
     }
-    delay(10);
 }
 
 
@@ -5,8 +5,12 @@
 #define USE_ARDUINO_GFX_LIBRARY
 #include <Arduino.h>
 #include "lv_xiao_round_screen.h"
-#include "touch_swipe.h"
+#include "touch_gesture.h"
 #include "touch_sensor_functions.h"
+#include "anim_offsets.h"
+
+struct sprite_rot_cache_t;
+struct sprite_stack_t;
 
 typedef struct {
     lv_obj_t  *obj;
@@ -14,6 +18,11 @@ typedef struct {
     lv_coord_t base_y;
     uint16_t   index;  // store which layer number
     uint16_t   total_sprites; 
+    const lv_img_dsc_t        *src;    // original (un-rotated) layer image
+    struct sprite_rot_cache_t *cache;  // pre-rotated frames, NULL = live rotation
+    struct sprite_stack_t     *stack;  // compositor drawing this layer, NULL = own object
+    lv_coord_t half_w;                 // src->header.w / 2, cached at creation
+    lv_coord_t half_h;
 } pivot_sprite_t;
 
 extern pivot_sprite_t g_sprites[];
@@ -33,11 +42,36 @@ typedef void (*sprite_exec_cb_t)(void *var, int32_t v);
 
 void pet_anim(void * var, int32_t v);
 
+// Per-layer offsets the exec callbacks apply: pet_pivot_offset(), ... in anim_offsets.h
+
+/*
+  Most rows the layer pivots of a count-layer stack are ever apart within one
+  frame of pet_anim, item_anim or rotate_anim; what a composited stack has to
+  leave room for on top of one rotated layer. 0 for other callbacks.
+*/
+lv_coord_t stack_anim_lift(void (*exec_cb)(void *, int32_t), uint16_t count);
+
 void item_anim(void * var, int32_t v);
 
 void rotate_anim(void * var, int32_t v);
 
 
+#define STACK_ANIM_MAX_LAYERS  20    // layers one stack animation moves
+#define STACK_ANIM_MAX_DRIVERS 8     // stacks that can be animated
+
+// One lv_anim per stack: LVGL evaluates the path once per tick and the driver
+// runs the layer callback over every layer with that value
+typedef struct {
+    pivot_sprite_t   *sprites;
+    uint16_t          sprite_count;
+    sprite_exec_cb_t  exec_cb;       // per-layer pose, e.g. pet_anim
+} stack_anim_driver_t;
+
+/**
+ * @brief Animates every layer of a stack from *current_angle to
+ *        *current_angle + end_angle_offset and stores the end angle back.
+ *        Replaces whatever animation the stack was running.
+ */
 void stack_anim(
     pivot_sprite_t    *sprites,
     uint16_t           sprite_count,
@@ -48,13 +82,70 @@ void stack_anim(
     sprite_exec_cb_t   exec_cb  // e.g. pet_anim
 );
 
+// Same, with a callback once the whole stack has finished (never for infinite ones)
+void stack_anim_ex(
+    pivot_sprite_t    *sprites,
+    uint16_t           sprite_count,
+    int32_t           *current_angle,
+    int32_t            end_angle_offset,
+    uint32_t           duration,
+    bool               infinite,
+    sprite_exec_cb_t   exec_cb,
+    lv_anim_ready_cb_t ready_cb
+);
+
+// Invalidate each moving stack as one rectangle per tick, the old and new
+// bounds of all its layers joined, instead of letting every lv_img_set_angle()
+// and lv_obj_set_pos() invalidate its own old and new box. 0 keeps
+// per-object invalidation; the counters below are kept either way.
+#ifndef STACK_ANIM_UNION_INVALIDATE
+#define STACK_ANIM_UNION_INVALIDATE 1
+#endif
+
+typedef struct {
+    lv_area_t  area;                 // union so far
+    bool       valid;
+    lv_obj_t  *screen;               // where the union is invalidated
+} stack_inval_t;
+
+typedef struct {
+    uint32_t frames;                 // stack_inval_frame_end() calls
+    uint32_t updates;                // stack updates (one per stack and tick)
+    uint64_t layer_px;               // old + new box of every object: what per-object invalidation asks for
+    uint64_t union_px;               // the one box per update
+    uint32_t frame_layer_px;         // same two, for the last finished frame
+    uint32_t frame_union_px;
+    uint32_t max_frame_union_px;
+} stack_inval_stats_t;
+
+/**
+ * @brief Brackets one stack update:
+ *          stack_inval_begin(&inv);
+ *          stack_inval_add(&inv, obj) for every object   (old bounds)
+ *          ... move / rotate them ...
+ *          stack_inval_layout(obj)                       (apply the moves)
+ *          stack_inval_add(&inv, obj) for every object   (new bounds)
+ *          stack_inval_end(&inv);
+ *        Between begin and end the display ignores invalidations; end
+ *        invalidates the union once. Hidden objects don't count.
+ */
+void stack_inval_begin(stack_inval_t *inval);
+void stack_inval_add(stack_inval_t *inval, lv_obj_t *obj);
+
+// lv_obj_set_pos() and lv_img_set_src() only mark the layout dirty; this runs
+// the layout pass for obj's screen so its coords (and the invalidations the
+// move makes, suppressed inside the bracket) are current
+void stack_inval_layout(lv_obj_t *obj);
+void stack_inval_end(stack_inval_t *inval);
+
+// Closes the per-frame counters; call once per loop() pass
+void stack_inval_frame_end(void);
+const stack_inval_stats_t *stack_inval_stats(void);
+void stack_inval_stats_reset(void);
+
+// Plays the animation for a swipe the tracker (start box, min length) recognised this pass
 void swipe_anim(
-    int                  x_min, 
-    int                  x_max, 
-    int                  y_min, 
-    int                  y_max, 
-    int                  min_swipe_length, 
-    swipe_tracker_t     *tracker, 
+    touch_gesture_tracker_t *tracker, 
     int32_t             *current_angle,
 
     // The array of sprites and how many
@@ -120,4 +211,4 @@ void stack_anim_rotate(
     bool            infinite
 );
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
@@ -0,0 +1,103 @@
+#include "background.h"
+
+static lv_color_t row_colors[SCREEN_HEIGHT];   // the pre-rendered background
+static lv_area_t  screen_area;
+
+//----------------------- Pre-render ------------------------
+
+// Same steps as LVGL's own vertical gradient: 8-bit channels mixed by row,
+// then converted to the display's colour format
+static void render_rows(const background_band_t *bands, uint8_t count)
+{
+    for (lv_coord_t y = 0; y < SCREEN_HEIGHT; y++) {
+        row_colors[y] = lv_color_black();
+    }
+
+    for (uint8_t n = 0; n < count; n++) {
+        const background_band_t *band = &bands[n];
+        int32_t last = band->h > 1 ? band->h - 1 : 1;
+        for (lv_coord_t i = 0; i < band->h; i++) {
+            lv_coord_t y = band->y + i;
+            if (y < 0 || y >= SCREEN_HEIGHT) {
+                continue;
+            }
+            uint32_t mix  = (uint32_t)LV_MIN(i, last) * 255 / last;
+            uint32_t imix = 255 - mix;
+            uint8_t  r = (((band->bottom >> 16) & 0xFF) * mix + ((band->top >> 16) & 0xFF) * imix) / 255;
+            uint8_t  g = (((band->bottom >> 8) & 0xFF) * mix + ((band->top >> 8) & 0xFF) * imix) / 255;
+            uint8_t  b = ((band->bottom & 0xFF) * mix + (band->top & 0xFF) * imix) / 255;
+            row_colors[y] = lv_color_make(r, g, b);
+        }
+    }
+}
+
+//----------------------- Draw hook ------------------------
+
+#if LVGL_VERSION_MAJOR == 8
+static void screen_event_cb(lv_event_t *e)
+{
+    if (lv_event_get_code(e) == LV_EVENT_COVER_CHECK) {
+        // The rows cover the whole screen, so LVGL can start drawing here
+        // instead of clearing the area with the display colour first
+        lv_cover_check_info_t *info = (lv_cover_check_info_t *)lv_event_get_param(e);
+        if (info->res != LV_COVER_RES_MASKED) {
+            info->res = LV_COVER_RES_COVER;
+        }
+        return;
+    }
+
+    // LV_EVENT_DRAW_MAIN: runs before any child is drawn
+    lv_draw_ctx_t *ctx = lv_event_get_draw_ctx(e);
+    lv_area_t      area;
+    if (!ctx->buf || !_lv_area_intersect(&area, ctx->clip_area, &screen_area)) {
+        return;
+    }
+
+    lv_color_t *buf   = (lv_color_t *)ctx->buf;
+    lv_coord_t  buf_w = lv_area_get_width(ctx->buf_area);
+    uint32_t    w     = lv_area_get_width(&area);
+    for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+        lv_color_t *dst = buf + (y - ctx->buf_area->y1) * buf_w + (area.x1 - ctx->buf_area->x1);
+        lv_color_fill(dst, row_colors[y], w);
+    }
+}
+#endif
+
+//----------------------- Setup ------------------------
+
+static void create_band_objects(lv_obj_t *screen, const background_band_t *bands, uint8_t count)
+{
+    for (uint8_t b = 0; b < count; b++) {
+        lv_obj_t *obj = lv_obj_create(screen);
+        lv_obj_remove_style_all(obj);                  // Remove default styles
+        lv_obj_set_size(obj, SCREEN_WIDTH, bands[b].h);
+        lv_obj_align(obj, LV_ALIGN_TOP_LEFT, 0, bands[b].y);
+        lv_obj_move_background(obj);                   // behind anything already there
+
+        lv_obj_set_style_bg_color(obj, lv_color_hex(bands[b].top), 0);
+        lv_obj_set_style_bg_grad_color(obj, lv_color_hex(bands[b].bottom), 0);
+        lv_obj_set_style_bg_grad_dir(obj, LV_GRAD_DIR_VER, 0);
+        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, 0);
+    }
+}
+
+void background_create(lv_obj_t *screen, const background_band_t *bands, uint8_t count,
+                       bool prerendered)
+{
+#if LVGL_VERSION_MAJOR == 8
+    if (prerendered) {
+        render_rows(bands, count);
+        lv_area_set(&screen_area, 0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1);
+
+        // The screen's own background would only be painted over
+        lv_obj_set_style_bg_opa(screen, LV_OPA_TRANSP, 0);
+        lv_obj_add_event_cb(screen, screen_event_cb, LV_EVENT_COVER_CHECK, NULL);
+        lv_obj_add_event_cb(screen, screen_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+        lv_obj_invalidate(screen);
+        return;
+    }
+#else
+    (void)prerendered;
+#endif
+    create_band_objects(screen, bands, count);
+}
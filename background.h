@@ -0,0 +1,39 @@
+#ifndef BACKGROUND_H
+#define BACKGROUND_H
+
+#include <lvgl.h>
+#include "lv_xiao_round_screen.h"
+
+/*
+   Screen background made of horizontal bands, each a vertical gradient.
+
+   Pre-rendered (the default on LVGL v8) the gradients are evaluated once into
+   one RGB565 colour per row, 480 bytes, and the screen's own draw event fills
+   the rows of each dirty area straight into the draw buffer. No background
+   objects exist and LVGL never interpolates a gradient again.
+
+   Otherwise each band is an lv_obj with a gradient style, as the sketch used
+   to do; LVGL then redraws the gradient pixel by pixel under every dirty
+   area. LVGL v9 always takes this path.
+*/
+#ifndef BACKGROUND_PRERENDERED
+#define BACKGROUND_PRERENDERED 1
+#endif
+
+typedef struct {
+    lv_coord_t y;          // first row
+    lv_coord_t h;          // rows
+    uint32_t   top;        // 0xRRGGBB at the first row
+    uint32_t   bottom;     // 0xRRGGBB at the last row
+} background_band_t;
+
+/**
+ * @brief Puts the bands behind everything else on 'screen'. Rows no band
+ *        covers are black.
+ *
+ * @param prerendered  false creates one gradient object per band instead
+ */
+void background_create(lv_obj_t *screen, const background_band_t *bands, uint8_t count,
+                       bool prerendered);
+
+#endif // BACKGROUND_H
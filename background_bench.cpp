@@ -0,0 +1,56 @@
+#include "background_bench.h"
+
+// A full redraw and a box the size of one spinning sprite stack
+static const lv_area_t BENCH_AREAS[] = {
+    {0, 0, SCREEN_WIDTH - 1, SCREEN_HEIGHT - 1},
+    {90, 90, 149, 149},
+};
+static const char *const BENCH_AREA_NAMES[] = {"full", "sprite"};
+#define BENCH_AREA_COUNT (sizeof(BENCH_AREAS) / sizeof(BENCH_AREAS[0]))
+
+void background_bench_run(const background_band_t *bands, uint8_t count, uint16_t frames)
+{
+    lv_obj_t *previous = lv_scr_act();
+
+    Serial.println("variant,area,render us/frame,ms/frame");
+
+    for (uint8_t v = 0; v < 2; v++) {
+        bool      prerendered = v == 1;
+        lv_obj_t *scene       = lv_obj_create(NULL);
+        background_create(scene, bands, count, prerendered);
+        lv_scr_load(scene);
+
+        // One untimed frame so the first measurement isn't the screen load
+        lv_refr_now(NULL);
+        lv_xiao_disp_sync();
+
+        for (uint8_t a = 0; a < BENCH_AREA_COUNT; a++) {
+            xiao_flush_stats_reset();
+
+            uint32_t start = micros();
+            for (uint16_t f = 0; f < frames; f++) {
+                lv_obj_invalidate_area(scene, &BENCH_AREAS[a]);
+                lv_refr_now(NULL);
+            }
+            uint32_t rendered = micros() - start;
+            lv_xiao_disp_sync();   // the last strip counts too
+            uint32_t elapsed = micros() - start;
+
+            // What is left once the flush callback and bus waits are taken out
+            const xiao_flush_stats_t *stats = xiao_flush_stats();
+            uint32_t bus    = stats->flush_us + stats->wait_us;
+            uint32_t render = rendered > bus ? rendered - bus : 0;
+
+            Serial.print(prerendered ? "prerendered" : "objects");
+            Serial.print(",");
+            Serial.print(BENCH_AREA_NAMES[a]);
+            Serial.print(",");
+            Serial.print(render / frames);
+            Serial.print(",");
+            Serial.println(elapsed / 1000.0f / frames, 2);
+        }
+
+        lv_scr_load(previous);
+        lv_obj_del(scene);
+    }
+}
@@ -0,0 +1,25 @@
+#ifndef BACKGROUND_BENCH_H
+#define BACKGROUND_BENCH_H
+
+#include <lvgl.h>
+#include "lv_xiao_round_screen.h"
+#include "background.h"
+
+// Render time depends on the MCU and its bus, so this stays on the board:
+// 1 compares the two backgrounds from setup() on a scratch screen.
+#ifndef BACKGROUND_BENCH
+#define BACKGROUND_BENCH 0
+#endif
+
+#define BACKGROUND_BENCH_FRAMES 60    // redraws per variant and area
+
+/**
+ * @brief Builds 'bands' both ways (gradient objects, pre-rendered rows) on a
+ *        scratch screen and redraws a full screen and a sprite-sized box
+ *        'frames' times each. Prints variant, area, render us/frame (bus
+ *        time left out) and total ms/frame over Serial, then puts the
+ *        previous screen back.
+ */
+void background_bench_run(const background_band_t *bands, uint8_t count, uint16_t frames);
+
+#endif // BACKGROUND_BENCH_H
@@ -0,0 +1,461 @@
+// Generated by host/sprite_rle_convert from bed.h; see sprite_rle.h
+#ifndef BED_RLE_H
+#define BED_RLE_H
+
+#include "sprite_rle.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "the palettes are RGB565 + A8; regenerate from the raw header for other depths"
+#endif
+
+// bed000: 32x32, 5 colours, 247 bytes (raw 3072)
+static const uint8_t bed000_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xe6, 0x69, 0xff, 0xc6, 0x69, 0xff,
+  0xa7, 0x92, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x69, 0xe6, 0xff, 0x69, 0xc6, 0xff,
+  0x92, 0xa7, 0xff,
+#endif
+};
+static const uint16_t bed000_rows[] = {
+  0, 2, 4, 28, 52, 64, 76, 88, 90, 92, 94, 96, 98, 100, 102, 104,
+  106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 136, 148, 160, 162, 164, 166,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed000_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x04,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x04, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00,
+  0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03,
+  0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x06, 0x03, 0x03, 0x03,
+  0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03,
+  0x03, 0x03, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed000_rle = {
+  SPRITE_RLE_MAGIC, 5, bed000_palette, bed000_rows, bed000_runs
+};
+
+const lv_img_dsc_t bed000 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed000_rle),
+  .data = (const uint8_t *)&bed000_rle,
+};
+
+// bed001: 32x32, 5 colours, 247 bytes (raw 3072)
+static const uint8_t bed001_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xe6, 0x69, 0xff, 0xc6, 0x69, 0xff,
+  0xa7, 0x92, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x69, 0xe6, 0xff, 0x69, 0xc6, 0xff,
+  0x92, 0xa7, 0xff,
+#endif
+};
+static const uint16_t bed001_rows[] = {
+  0, 2, 4, 28, 52, 64, 76, 88, 90, 92, 94, 96, 98, 100, 102, 104,
+  106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 136, 148, 160, 162, 164, 166,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed001_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x04,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x04, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00,
+  0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03,
+  0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x06, 0x03, 0x03, 0x03,
+  0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03,
+  0x03, 0x03, 0x06, 0x00, 0x06, 0x03, 0x03, 0x03, 0x03, 0x0e, 0x03, 0x03, 0x03, 0x03, 0x06, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed001_rle = {
+  SPRITE_RLE_MAGIC, 5, bed001_palette, bed001_rows, bed001_runs
+};
+
+const lv_img_dsc_t bed001 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed001_rle),
+  .data = (const uint8_t *)&bed001_rle,
+};
+
+// bed002: 32x32, 7 colours, 721 bytes (raw 3072)
+static const uint8_t bed002_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xa7, 0x92, 0xff, 0xe6, 0x69, 0xff,
+  0xc6, 0x69, 0xff, 0xff, 0xce, 0xff, 0xff, 0xd6, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x92, 0xa7, 0xff, 0x69, 0xe6, 0xff,
+  0x69, 0xc6, 0xff, 0xce, 0xff, 0xff, 0xd6, 0xff, 0xff,
+#endif
+};
+static const uint16_t bed002_rows[] = {
+  0, 2, 4, 28, 52, 76, 100, 124, 148, 172, 196, 220, 244, 268, 292, 316,
+  340, 364, 388, 412, 436, 460, 484, 508, 532, 556, 580, 604, 628, 630, 632, 634,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed002_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x02,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x00, 0x02, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x05,
+  0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x05, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed002_rle = {
+  SPRITE_RLE_MAGIC, 7, bed002_palette, bed002_rows, bed002_runs
+};
+
+const lv_img_dsc_t bed002 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed002_rle),
+  .data = (const uint8_t *)&bed002_rle,
+};
+
+// bed003: 32x32, 13 colours, 739 bytes (raw 3072)
+static const uint8_t bed003_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xe6, 0x69, 0xff, 0xc6, 0x69, 0xff,
+  0xa7, 0x92, 0xff, 0x9c, 0x5b, 0xff, 0x7c, 0x63, 0xff, 0x7c, 0x5b, 0xff,
+  0x9c, 0x63, 0xff, 0xff, 0xff, 0xff, 0x9d, 0x63, 0xff, 0x11, 0x8c, 0xff,
+  0x11, 0x84, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x69, 0xe6, 0xff, 0x69, 0xc6, 0xff,
+  0x92, 0xa7, 0xff, 0x5b, 0x9c, 0xff, 0x63, 0x7c, 0xff, 0x5b, 0x7c, 0xff,
+  0x63, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x63, 0x9d, 0xff, 0x8c, 0x11, 0xff,
+  0x84, 0x11, 0xff,
+#endif
+};
+static const uint16_t bed003_rows[] = {
+  0, 2, 4, 28, 52, 76, 100, 124, 148, 172, 196, 220, 244, 268, 292, 316,
+  340, 364, 388, 412, 436, 460, 484, 508, 532, 556, 580, 604, 628, 630, 632, 634,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed003_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x04,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x04, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x09, 0x0a,
+  0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08,
+  0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x0a,
+  0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08,
+  0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x0b, 0x06, 0x00, 0x06, 0x14, 0x09, 0x0a,
+  0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x0c, 0x06, 0x00, 0x06, 0x14, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08,
+  0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x0b, 0x06, 0x00, 0x06, 0x14, 0x09, 0x0a,
+  0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08,
+  0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x09, 0x06, 0x00, 0x06, 0x14, 0x0b, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x09, 0x06, 0x00, 0x06, 0x14, 0x0c, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x0a,
+  0x07, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05,
+  0x06, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08,
+  0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x09, 0x06, 0x00, 0x06, 0x14, 0x08, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed003_rle = {
+  SPRITE_RLE_MAGIC, 13, bed003_palette, bed003_rows, bed003_runs
+};
+
+const lv_img_dsc_t bed003 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed003_rle),
+  .data = (const uint8_t *)&bed003_rle,
+};
+
+// bed004: 32x32, 13 colours, 739 bytes (raw 3072)
+static const uint8_t bed004_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xe6, 0x69, 0xff, 0xc6, 0x69, 0xff,
+  0xa7, 0x92, 0xff, 0x9c, 0x5b, 0xff, 0x7c, 0x63, 0xff, 0x7c, 0x5b, 0xff,
+  0x9c, 0x63, 0xff, 0xff, 0xff, 0xff, 0x12, 0x8c, 0xff, 0xf1, 0x8b, 0xff,
+  0x11, 0x8c, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x69, 0xe6, 0xff, 0x69, 0xc6, 0xff,
+  0x92, 0xa7, 0xff, 0x5b, 0x9c, 0xff, 0x63, 0x7c, 0xff, 0x5b, 0x7c, 0xff,
+  0x63, 0x9c, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x12, 0xff, 0x8b, 0xf1, 0xff,
+  0x8c, 0x11, 0xff,
+#endif
+};
+static const uint16_t bed004_rows[] = {
+  0, 2, 4, 28, 52, 76, 100, 124, 148, 172, 196, 220, 244, 268, 292, 316,
+  340, 364, 388, 412, 436, 460, 484, 508, 532, 556, 580, 604, 628, 630, 632, 634,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed004_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x04,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x04, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x05, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x06, 0x14, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09, 0x09, 0x0a, 0x0b, 0x0c, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x0a, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x0b, 0x0c, 0x09,
+  0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0c, 0x0b, 0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x0a, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09,
+  0x0a, 0x0b, 0x0c, 0x0b, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0b, 0x0c, 0x0b,
+  0x0c, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x0a, 0x0b, 0x0c, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x0c, 0x0b, 0x0c, 0x0b, 0x09, 0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09,
+  0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x06, 0x00, 0x06, 0x14, 0x08, 0x07,
+  0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07, 0x08, 0x07,
+  0x08, 0x07, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed004_rle = {
+  SPRITE_RLE_MAGIC, 13, bed004_palette, bed004_rows, bed004_runs
+};
+
+const lv_img_dsc_t bed004 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed004_rle),
+  .data = (const uint8_t *)&bed004_rle,
+};
+
+// bed005: 32x32, 6 colours, 302 bytes (raw 3072)
+static const uint8_t bed005_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xa7, 0x92, 0xff, 0xe6, 0x69, 0xff,
+  0xc6, 0x69, 0xff, 0xff, 0xff, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x92, 0xa7, 0xff, 0x69, 0xe6, 0xff,
+  0x69, 0xc6, 0xff, 0xff, 0xff, 0xff,
+#endif
+};
+static const uint16_t bed005_rows[] = {
+  0, 2, 4, 28, 52, 54, 72, 90, 108, 126, 144, 162, 180, 182, 184, 186,
+  188, 190, 192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed005_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x02,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x00, 0x02, 0x06, 0x00, 0x20, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00,
+  0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x09, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x09, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed005_rle = {
+  SPRITE_RLE_MAGIC, 6, bed005_palette, bed005_rows, bed005_runs
+};
+
+const lv_img_dsc_t bed005 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed005_rle),
+  .data = (const uint8_t *)&bed005_rle,
+};
+
+// bed006: 32x32, 10 colours, 314 bytes (raw 3072)
+static const uint8_t bed006_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xe6, 0x69, 0xff, 0xc6, 0x69, 0xff,
+  0xa7, 0x92, 0xff, 0xff, 0xff, 0xff, 0x12, 0x8c, 0xff, 0xf1, 0x8b, 0xff,
+  0x11, 0x8c, 0xff, 0xf1, 0x83, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x69, 0xe6, 0xff, 0x69, 0xc6, 0xff,
+  0x92, 0xa7, 0xff, 0xff, 0xff, 0xff, 0x8c, 0x12, 0xff, 0x8b, 0xf1, 0xff,
+  0x8c, 0x11, 0xff, 0x83, 0xf1, 0xff,
+#endif
+};
+static const uint16_t bed006_rows[] = {
+  0, 2, 4, 28, 52, 54, 72, 90, 108, 126, 144, 162, 180, 182, 184, 186,
+  188, 190, 192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed006_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x04,
+  0x02, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+  0x00, 0x04, 0x06, 0x00, 0x20, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x06, 0x07,
+  0x08, 0x07, 0x08, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e, 0x05, 0x06,
+  0x07, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x06, 0x05, 0x05, 0x09, 0x00, 0x09, 0x0e,
+  0x05, 0x05, 0x08, 0x07, 0x08, 0x07, 0x08, 0x05, 0x05, 0x05, 0x08, 0x09, 0x05, 0x05, 0x09, 0x00,
+  0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x08, 0x07, 0x08, 0x09, 0x08, 0x05, 0x05, 0x05,
+  0x09, 0x00, 0x09, 0x0e, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+  0x05, 0x05, 0x09, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed006_rle = {
+  SPRITE_RLE_MAGIC, 10, bed006_palette, bed006_rows, bed006_runs
+};
+
+const lv_img_dsc_t bed006 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed006_rle),
+  .data = (const uint8_t *)&bed006_rle,
+};
+
+// bed007: 32x32, 5 colours, 187 bytes (raw 3072)
+static const uint8_t bed007_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xa7, 0x92, 0xff, 0xe6, 0x69, 0xff,
+  0xc6, 0x69, 0xff,
+#else
+  0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x92, 0xa7, 0xff, 0x69, 0xe6, 0xff,
+  0x69, 0xc6, 0xff,
+#endif
+};
+static const uint16_t bed007_rows[] = {
+  0, 2, 4, 28, 52, 54, 56, 58, 60, 62, 64, 66, 68, 70, 72, 74,
+  76, 78, 80, 82, 84, 86, 88, 90, 92, 94, 96, 98, 100, 102, 104, 106,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t bed007_runs[] = {
+  0x20, 0x00, 0x20, 0x00, 0x06, 0x14, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x06, 0x00, 0x06, 0x14, 0x00, 0x02,
+  0x03, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+  0x00, 0x02, 0x06, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+  0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00,
+};
+static const sprite_rle_t bed007_rle = {
+  SPRITE_RLE_MAGIC, 5, bed007_palette, bed007_rows, bed007_runs
+};
+
+const lv_img_dsc_t bed007 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 32,
+      .h = 32,
+  },
+  .data_size = sizeof(bed007_rle),
+  .data = (const uint8_t *)&bed007_rle,
+};
+
+// Largest layer unpacked
+#define BED_RLE_MAX_LAYER_BYTES 3072
+#if SPRITE_RLE_ASSETS
+static_assert(BED_RLE_MAX_LAYER_BYTES <= SPRITE_RLE_SCRATCH_BYTES,
+              "a layer outgrew the scratch; raise SPRITE_RLE_MAX_LAYER_BYTES");
+#endif
+
+#endif // BED_RLE_H
@@ -0,0 +1,378 @@
+// Generated by host/sprite_rle_convert from burger.h; see sprite_rle.h
+#ifndef BURGER_RLE_H
+#define BURGER_RLE_H
+
+#include "sprite_rle.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "the palettes are RGB565 + A8; regenerate from the raw header for other depths"
+#endif
+
+// burger000: 16x16, 2 colours, 286 bytes (raw 768)
+static const uint8_t burger000_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0x33, 0xf6, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0xf6, 0x33, 0xff,
+#endif
+};
+static const uint16_t burger000_rows[] = {
+  0, 10, 22, 36, 52, 70, 88, 106, 124, 142, 160, 178, 196, 212, 226, 238,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger000_runs[] = {
+  0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x02, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x10,
+  0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x00, 0x10, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x00, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+  0x03, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x06,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+};
+static const sprite_rle_t burger000_rle = {
+  SPRITE_RLE_MAGIC, 2, burger000_palette, burger000_rows, burger000_runs
+};
+
+const lv_img_dsc_t burger000 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger000_rle),
+  .data = (const uint8_t *)&burger000_rle,
+};
+
+// burger001: 16x16, 2 colours, 298 bytes (raw 768)
+static const uint8_t burger001_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0x33, 0xf6, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0xf6, 0x33, 0xff,
+#endif
+};
+static const uint16_t burger001_rows[] = {
+  0, 10, 24, 40, 58, 76, 94, 112, 130, 148, 166, 184, 202, 220, 236, 250,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger001_runs[] = {
+  0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00,
+};
+static const sprite_rle_t burger001_rle = {
+  SPRITE_RLE_MAGIC, 2, burger001_palette, burger001_rows, burger001_runs
+};
+
+const lv_img_dsc_t burger001 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger001_rle),
+  .data = (const uint8_t *)&burger001_rle,
+};
+
+// burger002: 16x16, 1 colours, 261 bytes (raw 768)
+static const uint8_t burger002_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xc6, 0x69, 0xff,
+#else
+  0x69, 0xc6, 0xff,
+#endif
+};
+static const uint16_t burger002_rows[] = {
+  0, 9, 20, 33, 48, 65, 82, 100, 118, 136, 154, 172, 188, 202, 214, 224,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger002_runs[] = {
+  0x06, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x05, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x04, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x00, 0x03, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x02, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00,
+  0x10, 0x00,
+};
+static const sprite_rle_t burger002_rle = {
+  SPRITE_RLE_MAGIC, 1, burger002_palette, burger002_rows, burger002_runs
+};
+
+const lv_img_dsc_t burger002 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger002_rle),
+  .data = (const uint8_t *)&burger002_rle,
+};
+
+// burger003: 16x16, 2 colours, 264 bytes (raw 768)
+static const uint8_t burger003_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xa7, 0xff, 0xff, 0x87, 0xff, 0xff,
+#else
+  0xff, 0xa7, 0xff, 0xff, 0x87, 0xff,
+#endif
+};
+static const uint16_t burger003_rows[] = {
+  0, 9, 20, 33, 47, 63, 81, 100, 118, 134, 150, 165, 179, 193, 206, 217,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger003_runs[] = {
+  0x04, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x03, 0x07, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x06, 0x00, 0x02, 0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x05,
+  0x00, 0x01, 0x0a, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00, 0x00,
+  0x0c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x04, 0x00, 0x00,
+  0x0e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02,
+  0x00, 0x00, 0x0f, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x02, 0x0e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x0e, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x03, 0x0d, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x0c, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x00, 0x01, 0x05, 0x0a, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01,
+  0x00, 0x06, 0x09, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x07, 0x07,
+  0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x02, 0x00, 0x08, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00,
+  0x03, 0x00,
+};
+static const sprite_rle_t burger003_rle = {
+  SPRITE_RLE_MAGIC, 2, burger003_palette, burger003_rows, burger003_runs
+};
+
+const lv_img_dsc_t burger003 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger003_rle),
+  .data = (const uint8_t *)&burger003_rle,
+};
+
+// burger004: 16x16, 4 colours, 301 bytes (raw 768)
+static const uint8_t burger004_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x2a, 0x9f, 0xff, 0x06, 0x6e, 0xff, 0xe6, 0x6d, 0xff, 0x4a, 0x9f, 0xff,
+#else
+  0x9f, 0x2a, 0xff, 0x6e, 0x06, 0xff, 0x6d, 0xe6, 0xff, 0x9f, 0x4a, 0xff,
+#endif
+};
+static const uint16_t burger004_rows[] = {
+  0, 8, 22, 37, 53, 70, 86, 103, 120, 136, 154, 172, 191, 207, 223, 242,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger004_runs[] = {
+  0x05, 0x04, 0x00, 0x00, 0x01, 0x00, 0x07, 0x00, 0x04, 0x0a, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
+  0x01, 0x02, 0x03, 0x02, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x02, 0x01,
+  0x02, 0x03, 0x00, 0x01, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x0f, 0x01, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x0e, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02,
+  0x03, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x00, 0x01, 0x02, 0x03, 0x02, 0x00, 0x00, 0x0f, 0x00, 0x01,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x03,
+  0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x03,
+  0x0c, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x02,
+  0x04, 0x00, 0x00, 0x00, 0x00, 0x01, 0x05, 0x01, 0x02, 0x03, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x03, 0x01, 0x00, 0x03, 0x03, 0x00, 0x01, 0x02, 0x01, 0x03, 0x00, 0x00, 0x01, 0x02,
+  0x00,
+};
+static const sprite_rle_t burger004_rle = {
+  SPRITE_RLE_MAGIC, 4, burger004_palette, burger004_rows, burger004_runs
+};
+
+const lv_img_dsc_t burger004 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger004_rle),
+  .data = (const uint8_t *)&burger004_rle,
+};
+
+// burger005: 16x16, 7 colours, 289 bytes (raw 768)
+static const uint8_t burger005_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0xa6, 0xb1, 0xff, 0x86, 0xa9, 0xff, 0xcc, 0xda, 0xff, 0xa6, 0xa9, 0xff,
+  0x86, 0xb1, 0xff, 0xcd, 0xda, 0xff, 0xcd, 0xe2, 0xff,
+#else
+  0xb1, 0xa6, 0xff, 0xa9, 0x86, 0xff, 0xda, 0xcc, 0xff, 0xa9, 0xa6, 0xff,
+  0xb1, 0x86, 0xff, 0xda, 0xcd, 0xff, 0xe2, 0xcd, 0xff,
+#endif
+};
+static const uint16_t burger005_rows[] = {
+  0, 7, 21, 39, 57, 75, 91, 105, 117, 128, 139, 152, 170, 188, 206, 224,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger005_runs[] = {
+  0x03, 0x03, 0x00, 0x01, 0x00, 0x0a, 0x00, 0x02, 0x05, 0x02, 0x03, 0x04, 0x05, 0x02, 0x04, 0x03,
+  0x02, 0x05, 0x00, 0x02, 0x00, 0x01, 0x07, 0x00, 0x05, 0x02, 0x05, 0x02, 0x05, 0x00, 0x02, 0x05,
+  0x00, 0x05, 0x02, 0x03, 0x04, 0x01, 0x00, 0x01, 0x07, 0x03, 0x02, 0x05, 0x02, 0x05, 0x00, 0x01,
+  0x01, 0x07, 0x00, 0x01, 0x02, 0x05, 0x02, 0x05, 0x00, 0x01, 0x07, 0x00, 0x01, 0x02, 0x05, 0x00,
+  0x01, 0x00, 0x01, 0x07, 0x03, 0x04, 0x05, 0x02, 0x05, 0x02, 0x05, 0x02, 0x05, 0x00, 0x01, 0x02,
+  0x03, 0x04, 0x02, 0x07, 0x00, 0x01, 0x02, 0x05, 0x02, 0x00, 0x01, 0x03, 0x03, 0x00, 0x01, 0x00,
+  0x04, 0x05, 0x02, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x04, 0x03, 0x00, 0x01, 0x00, 0x04, 0x03,
+  0x00, 0x01, 0x00, 0x02, 0x00, 0x02, 0x07, 0x00, 0x01, 0x05, 0x00, 0x01, 0x00, 0x01, 0x07, 0x00,
+  0x02, 0x07, 0x03, 0x06, 0x02, 0x05, 0x00, 0x01, 0x00, 0x07, 0x00, 0x01, 0x09, 0x00, 0x01, 0x00,
+  0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x00, 0x01, 0x09, 0x03, 0x04, 0x03, 0x02, 0x05, 0x02,
+  0x03, 0x04, 0x03, 0x01, 0x03, 0x00, 0x01, 0x00, 0x02, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x06, 0x02,
+  0x02, 0x05, 0x00, 0x01, 0x00, 0x01, 0x05, 0x00, 0x05, 0x00, 0x01, 0x00, 0x02, 0x07, 0x02, 0x02,
+  0x00, 0x01, 0x02, 0x05, 0x00, 0x01, 0x05, 0x00, 0x02, 0x05, 0x02, 0x03, 0x01, 0x00, 0x02, 0x07,
+  0x02, 0x05, 0x03, 0x04, 0x05, 0x02, 0x03, 0x01, 0x05, 0x03, 0x04, 0x02, 0x05, 0x00, 0x01, 0x00,
+  0x04, 0x03, 0x00, 0x01, 0x00, 0x04, 0x03, 0x03, 0x05, 0x00, 0x02, 0x00,
+};
+static const sprite_rle_t burger005_rle = {
+  SPRITE_RLE_MAGIC, 7, burger005_palette, burger005_rows, burger005_runs
+};
+
+const lv_img_dsc_t burger005 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger005_rle),
+  .data = (const uint8_t *)&burger005_rle,
+};
+
+// burger006: 16x16, 2 colours, 298 bytes (raw 768)
+static const uint8_t burger006_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0x33, 0xf6, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0xf6, 0x33, 0xff,
+#endif
+};
+static const uint16_t burger006_rows[] = {
+  0, 10, 24, 40, 58, 76, 94, 112, 130, 148, 166, 184, 202, 220, 236, 250,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger006_runs[] = {
+  0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x10,
+  0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+  0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x10, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00,
+  0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x03, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00,
+};
+static const sprite_rle_t burger006_rle = {
+  SPRITE_RLE_MAGIC, 2, burger006_palette, burger006_rows, burger006_runs
+};
+
+const lv_img_dsc_t burger006 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger006_rle),
+  .data = (const uint8_t *)&burger006_rle,
+};
+
+// burger007: 16x16, 4 colours, 260 bytes (raw 768)
+static const uint8_t burger007_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0x33, 0xf6, 0xff, 0xc8, 0x92, 0xff, 0xc7, 0x92, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0xf6, 0x33, 0xff, 0x92, 0xc8, 0xff, 0x92, 0xc7, 0xff,
+#endif
+};
+static const uint16_t burger007_rows[] = {
+  0, 2, 12, 24, 38, 54, 72, 90, 108, 126, 144, 162, 178, 192, 204, 214,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t burger007_runs[] = {
+  0x10, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x04, 0x08, 0x00, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x00, 0x03, 0x0a, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x01, 0x00, 0x03, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x02,
+  0x01, 0x01, 0x01, 0x00, 0x02, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x02, 0x01,
+  0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x01,
+  0x01, 0x01, 0x01, 0x03, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x00, 0x01, 0x00, 0x01, 0x0e,
+  0x00, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x02, 0x01, 0x02, 0x01, 0x01, 0x00, 0x01, 0x00,
+  0x01, 0x0e, 0x00, 0x01, 0x02, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00,
+  0x01, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x02, 0x01, 0x01, 0x02, 0x01, 0x01, 0x03, 0x01, 0x01, 0x00,
+  0x02, 0x00, 0x03, 0x0a, 0x00, 0x01, 0x01, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x03, 0x00,
+  0x04, 0x08, 0x00, 0x01, 0x01, 0x02, 0x01, 0x01, 0x01, 0x00, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x10, 0x00,
+};
+static const sprite_rle_t burger007_rle = {
+  SPRITE_RLE_MAGIC, 4, burger007_palette, burger007_rows, burger007_runs
+};
+
+const lv_img_dsc_t burger007 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(burger007_rle),
+  .data = (const uint8_t *)&burger007_rle,
+};
+
+// Largest layer unpacked
+#define BURGER_RLE_MAX_LAYER_BYTES 768
+#if SPRITE_RLE_ASSETS
+static_assert(BURGER_RLE_MAX_LAYER_BYTES <= SPRITE_RLE_SCRATCH_BYTES,
+              "a layer outgrew the scratch; raise SPRITE_RLE_MAX_LAYER_BYTES");
+#endif
+
+#endif // BURGER_RLE_H
@@ -0,0 +1,95 @@
+#include "display_bench.h"
+
+static const uint16_t BENCH_ROWS[] = {10, 20, 40, 80, SCREEN_HEIGHT};
+#define BENCH_SIZES (sizeof(BENCH_ROWS) / sizeof(BENCH_ROWS[0]))
+
+//----------------------- Scene ------------------------
+
+// Roughly what the pet screen costs: gradients, arcs, text, some blending
+static lv_obj_t *create_scene(lv_obj_t **arc_out)
+{
+    lv_obj_t *scene = lv_obj_create(NULL);
+    lv_obj_set_style_bg_color(scene, lv_color_hex(0x4682B4), 0);
+    lv_obj_set_style_bg_grad_color(scene, lv_color_hex(0x3CB371), 0);
+    lv_obj_set_style_bg_grad_dir(scene, LV_GRAD_DIR_VER, 0);
+    lv_obj_set_style_bg_opa(scene, LV_OPA_COVER, 0);
+
+    lv_obj_t *arc = lv_arc_create(scene);
+    lv_obj_set_size(arc, 230, 230);
+    lv_obj_center(arc);
+    lv_arc_set_range(arc, 0, 100);
+    lv_obj_set_style_arc_width(arc, 12, LV_PART_MAIN);
+    lv_obj_set_style_arc_width(arc, 12, LV_PART_INDICATOR);
+    lv_obj_remove_style(arc, NULL, LV_PART_KNOB);
+    *arc_out = arc;
+
+    for (uint8_t i = 0; i < 6; i++) {
+        lv_obj_t *block = lv_obj_create(scene);
+        lv_obj_remove_style_all(block);
+        lv_obj_set_size(block, 48, 48);
+        lv_obj_set_pos(block, 40 + (i % 3) * 56, 70 + (i / 3) * 56);
+        lv_obj_set_style_radius(block, 8, 0);
+        lv_obj_set_style_bg_color(block, lv_color_hex(0xFFAA33), 0);
+        lv_obj_set_style_bg_opa(block, LV_OPA_70, 0);
+    }
+
+    lv_obj_t *label = lv_label_create(scene);
+    lv_label_set_text(label, "display bench");
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 40);
+
+    return scene;
+}
+
+//----------------------- Sweep ------------------------
+
+void display_bench_run(uint16_t frames)
+{
+    lv_obj_t *previous   = lv_scr_act();
+    uint16_t  saved_rows = lv_xiao_disp_buffer_rows();
+
+    lv_obj_t *arc;
+    lv_obj_t *scene = create_scene(&arc);
+    lv_scr_load(scene);
+
+    Serial.println("rows,double,flushes/frame,bytes/frame,saved/frame,ms/frame");
+
+    for (uint8_t s = 0; s < BENCH_SIZES; s++) {
+        uint16_t rows = lv_xiao_disp_set_buffer_rows(BENCH_ROWS[s]);
+        if (rows != BENCH_ROWS[s]) {
+            Serial.print(BENCH_ROWS[s]);
+            Serial.println(",skipped (no RAM),,,,");
+            continue;
+        }
+
+        // One untimed frame so the new buffers are warm
+        lv_refr_now(NULL);
+        lv_xiao_disp_sync();
+        xiao_flush_stats_reset();
+
+        uint32_t start = micros();
+        for (uint16_t f = 0; f < frames; f++) {
+            lv_arc_set_value(arc, f % 100);
+            lv_obj_invalidate(scene);
+            lv_refr_now(NULL);
+        }
+        lv_xiao_disp_sync();   // the last strip counts too
+        uint32_t elapsed = micros() - start;
+
+        const xiao_flush_stats_t *stats = xiao_flush_stats();
+        Serial.print(rows);
+        Serial.print(",");
+        Serial.print(lv_xiao_disp_double_buffered() ? "yes" : "no");
+        Serial.print(",");
+        Serial.print((float)stats->flushes / frames, 1);
+        Serial.print(",");
+        Serial.print(stats->bytes / frames);
+        Serial.print(",");
+        Serial.print(stats->bytes_saved / frames);
+        Serial.print(",");
+        Serial.println(elapsed / 1000.0f / frames, 2);
+    }
+
+    lv_xiao_disp_set_buffer_rows(saved_rows);
+    lv_scr_load(previous);
+    lv_obj_del(scene);
+}
@@ -0,0 +1,24 @@
+#ifndef DISPLAY_BENCH_H
+#define DISPLAY_BENCH_H
+
+#include <lvgl.h>
+#include "lv_xiao_round_screen.h"
+
+// The sweep times real SPI flushes, so it only means something on the board.
+// 1 runs it once at the end of setup() and then restores the dino screen.
+#ifndef DISPLAY_BENCH
+#define DISPLAY_BENCH 0
+#endif
+
+#define DISPLAY_BENCH_FRAMES 30       // full redraws per buffer size
+
+/**
+ * @brief Loads a fixed full-screen scene (gradient, arcs, label, blocks) and
+ *        redraws it 'frames' times for each draw-buffer height in
+ *        10/20/40/80/240 rows. Prints rows, buffering, flushes/frame,
+ *        bytes/frame, bytes saved by the round clip and ms/frame per size
+ *        over Serial, then puts the previous screen and buffer size back.
+ */
+void display_bench_run(uint16_t frames);
+
+#endif // DISPLAY_BENCH_H
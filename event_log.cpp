@@ -0,0 +1,171 @@
+#include "event_log.h"
+#include <stdarg.h>
+
+#define LOG_EVENT_FMT(id, fmt) fmt,
+static const char *const event_fmt[] = {
+    LOG_EVENTS(LOG_EVENT_FMT)
+};
+#undef LOG_EVENT_FMT
+
+static const char level_tag[] = {'E', 'W', 'I', 'D'};
+
+// Byte ring; log_write() is the only writer of head, log_drain() of tail
+static uint8_t  ring[LOG_RING_BYTES];
+static uint16_t ring_head = 0;
+static uint16_t ring_tail = 0;
+
+static log_mode_t  mode = LOG_MODE_TEXT;
+static log_stats_t stats;
+static uint32_t    reported_drops = 0;
+
+//----------------------- Ring ------------------------
+
+static inline uint16_t ring_used(void)
+{
+    return (uint16_t)(ring_head - ring_tail);
+}
+
+static void ring_put(const uint8_t *src, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        ring[(uint16_t)(ring_head + i) & (LOG_RING_BYTES - 1)] = src[i];
+    }
+    ring_head += len;
+}
+
+// Copies the oldest record out without consuming it; returns its size, 0 if none
+static uint8_t ring_peek(uint8_t *dst)
+{
+    if (ring_used() < LOG_RECORD_HEADER) {
+        return 0;
+    }
+    for (uint8_t i = 0; i < LOG_RECORD_HEADER; i++) {
+        dst[i] = ring[(uint16_t)(ring_tail + i) & (LOG_RING_BYTES - 1)];
+    }
+    uint8_t len = LOG_RECORD_HEADER + 4 * (dst[2] & 0x03);
+    for (uint8_t i = LOG_RECORD_HEADER; i < len; i++) {
+        dst[i] = ring[(uint16_t)(ring_tail + i) & (LOG_RING_BYTES - 1)];
+    }
+    return len;
+}
+
+static void put_u32(uint8_t *dst, uint32_t v)
+{
+    dst[0] = v;
+    dst[1] = v >> 8;
+    dst[2] = v >> 16;
+    dst[3] = v >> 24;
+}
+
+static int32_t get_i32(const uint8_t *src)
+{
+    return (int32_t)((uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+                     ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24));
+}
+
+//----------------------- Writing ------------------------
+
+void log_write(uint8_t id, uint8_t level, uint8_t argc, ...)
+{
+    uint8_t rec[LOG_RECORD_MAX];
+    if (argc > LOG_RECORD_MAX_ARGS) {
+        argc = LOG_RECORD_MAX_ARGS;
+    }
+    uint8_t len = LOG_RECORD_HEADER + 4 * argc;
+
+    if (LOG_RING_BYTES - ring_used() < len) {
+        stats.dropped++;
+        return;
+    }
+
+    rec[0] = LOG_RECORD_SYNC;
+    rec[1] = id;
+    rec[2] = argc | (level << 2);
+    put_u32(&rec[3], millis());
+
+    va_list args;
+    va_start(args, argc);
+    for (uint8_t i = 0; i < argc; i++) {
+        put_u32(&rec[LOG_RECORD_HEADER + 4 * i], (uint32_t)va_arg(args, int));
+    }
+    va_end(args);
+
+    ring_put(rec, len);
+    stats.records++;
+}
+
+//----------------------- Draining ------------------------
+
+static uint8_t format_record(const uint8_t *rec, char *line)
+{
+    uint8_t id    = rec[1];
+    uint8_t argc  = rec[2] & 0x03;
+    uint8_t level = (rec[2] >> 2) & 0x03;
+    long    a[LOG_RECORD_MAX_ARGS] = {0, 0, 0};
+    for (uint8_t i = 0; i < argc; i++) {
+        a[i] = get_i32(&rec[LOG_RECORD_HEADER + 4 * i]);
+    }
+
+    int n = snprintf(line, LOG_TEXT_MAX, "[%lu] %c ", (unsigned long)get_i32(&rec[3]), level_tag[level]);
+    if (id < LOG_EV_COUNT) {
+        n += snprintf(line + n, LOG_TEXT_MAX - n, event_fmt[id], a[0], a[1], a[2]);
+    } else {
+        n += snprintf(line + n, LOG_TEXT_MAX - n, "event %u", id);
+    }
+    if (n > LOG_TEXT_MAX - 3) {
+        n = LOG_TEXT_MAX - 3;   // snprintf reports what it would have written
+    }
+    line[n++] = '\r';
+    line[n++] = '\n';
+    return n;
+}
+
+void log_drain(void)
+{
+    if (mode == LOG_MODE_OFF) {
+        return;
+    }
+
+    uint8_t rec[LOG_RECORD_MAX];
+    char    line[LOG_TEXT_MAX];
+    uint8_t len;
+    while ((len = ring_peek(rec)) > 0) {
+        const uint8_t *out = rec;
+        uint8_t        out_len = len;
+        if (mode == LOG_MODE_TEXT) {
+            out_len = format_record(rec, line);
+            out     = (const uint8_t *)line;
+        }
+
+        // Stop rather than block once the USB / UART buffer is full
+        if (Serial.availableForWrite() < out_len) {
+            break;
+        }
+        Serial.write(out, out_len);
+        ring_tail += len;
+        stats.drained += out_len;
+    }
+
+    // Report losses through the ring itself, so they show up in order; only
+    // once there's room, or the notice would be lost as well
+    if (stats.dropped != reported_drops && LOG_RING_BYTES - ring_used() >= LOG_RECORD_HEADER + 4) {
+        uint32_t lost = stats.dropped - reported_drops;
+        reported_drops = stats.dropped;
+        LOG_EMIT(LOG_LEVEL_WARN, LOG_EV_DROPPED, (int)lost);
+    }
+}
+
+void log_set_mode(log_mode_t new_mode)
+{
+    mode = new_mode;
+}
+
+log_mode_t log_mode(void)
+{
+    return mode;
+}
+
+const log_stats_t *log_stats(void)
+{
+    return &stats;
+}
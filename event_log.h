@@ -0,0 +1,74 @@
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+#include <Arduino.h>
+#include "log_events.h"
+
+// Highest level compiled in; calls above it expand to nothing
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_BYTES  2048    // must be a power of two
+#define LOG_TEXT_MAX    64      // longest formatted line in text mode, fits a USB CDC packet
+
+typedef enum {
+    LOG_MODE_TEXT = 0,    // records are formatted into lines when drained
+    LOG_MODE_BINARY,      // records go out as they are, decode with host/log_decode
+    LOG_MODE_OFF          // records are kept until the mode changes
+} log_mode_t;
+
+typedef struct {
+    uint32_t records;   // records written to the ring
+    uint32_t dropped;   // records lost because the ring was full
+    uint32_t drained;   // bytes sent to Serial
+} log_stats_t;
+
+/**
+ * @brief Appends one record (id, level, millis(), args) to the RAM ring.
+ *        No formatting and no Serial traffic; not for use from an ISR.
+ *        Use the LOG_* macros rather than calling this directly.
+ */
+void log_write(uint8_t id, uint8_t level, uint8_t argc, ...);
+
+/**
+ * @brief Sends queued records while Serial has room, without ever waiting on
+ *        it. Call from idle time, e.g. at the end of loop().
+ */
+void log_drain(void);
+
+void log_set_mode(log_mode_t mode);
+log_mode_t log_mode(void);
+const log_stats_t *log_stats(void);
+
+// Number of int arguments, 0..3
+#define LOG_NARGS(...)  LOG_NARGS_(0, ##__VA_ARGS__, 3, 2, 1, 0)
+#define LOG_NARGS_(_0, _1, _2, _3, N, ...) N
+
+#define LOG_EMIT(level, id, ...) log_write((id), (level), LOG_NARGS(__VA_ARGS__), ##__VA_ARGS__)
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(id, ...) LOG_EMIT(LOG_LEVEL_ERROR, id, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(id, ...) do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(id, ...)  LOG_EMIT(LOG_LEVEL_WARN, id, ##__VA_ARGS__)
+#else
+#define LOG_WARN(id, ...)  do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(id, ...)  LOG_EMIT(LOG_LEVEL_INFO, id, ##__VA_ARGS__)
+#else
+#define LOG_INFO(id, ...)  do {} while (0)
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(id, ...) LOG_EMIT(LOG_LEVEL_DEBUG, id, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(id, ...) do {} while (0)
+#endif
+
+#endif // EVENT_LOG_H
@@ -0,0 +1,185 @@
+#include "gesture_capture.h"
+#include "gesture_stream.h"
+#include "imu_quant.h"
+#include "event_log.h"
+
+static LSM6DS3                 *capture_imu   = NULL;
+static gesture_result_cb_t      capture_cb    = NULL;
+static lv_timer_t              *capture_timer = NULL;
+static lv_obj_t                *progress_bar  = NULL;
+
+static gesture_capture_state_t  capture_state = GESTURE_CAPTURE_IDLE;
+static uint16_t                 samples_read  = 0;
+static unsigned long            armed_since   = 0;
+
+static int8_t                   window[GESTURE_WINDOW_LEN];
+static gesture_result_t         last_result;
+
+//----------------------- Progress indicator ------------------------
+
+static void show_progress(bool visible)
+{
+    if (!progress_bar) {
+        return;
+    }
+    if (visible) {
+        lv_bar_set_value(progress_bar, samples_read, LV_ANIM_OFF);
+        lv_obj_clear_flag(progress_bar, LV_OBJ_FLAG_HIDDEN);
+    } else {
+        lv_obj_add_flag(progress_bar, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+static void set_state(gesture_capture_state_t state)
+{
+    capture_state = state;
+
+    if (!capture_timer) {
+        return;
+    }
+    // Only burn timer slices while something is happening
+    if (state == GESTURE_CAPTURE_IDLE) {
+        lv_timer_pause(capture_timer);
+    } else {
+        lv_timer_resume(capture_timer);
+    }
+}
+
+static void capture_timer_cb(lv_timer_t *timer)
+{
+    gesture_capture_tick();
+}
+
+//----------------------- Per-state slices ------------------------
+
+static void store_sample(const imu_frame_t *frame)
+{
+    imu_quant_frame(frame, &window[samples_read * GESTURE_NUM_AXES]);
+    samples_read++;
+}
+
+static void armed_slice(unsigned long now)
+{
+    if (now - armed_since >= GESTURE_ARM_TIMEOUT_MS) {
+        LOG_WARN(LOG_EV_CAPTURE_TIMEOUT);
+        show_progress(false);
+        set_state(GESTURE_CAPTURE_IDLE);
+        return;
+    }
+
+    // Every frame the FIFO collected since the last slice is checked, so a
+    // short spike between two slices is not missed
+    imu_fifo_drain();
+
+    imu_frame_t frame;
+    while (imu_ring_pop(&frame)) {
+        float values[6];
+        imu_frame_to_float(&frame, values);
+        float aSum = fabs(values[0]) + fabs(values[1]) + fabs(values[2]);
+
+        if (aSum >= GESTURE_ACCEL_THRESHOLD) {
+            // The crossing frame is the first sample of the window
+            samples_read = 0;
+            store_sample(&frame);
+            set_state(GESTURE_CAPTURE_RECORDING);
+            return;
+        }
+    }
+}
+
+static void recording_slice(void)
+{
+    // Frames arrive at a fixed ODR from the FIFO, so slice timing does not
+    // affect sample timing
+    imu_fifo_drain();
+
+    imu_frame_t frame;
+    while (samples_read < GESTURE_NUM_SAMPLES && imu_ring_pop(&frame)) {
+        store_sample(&frame);
+    }
+
+    show_progress(true);
+
+    if (samples_read >= GESTURE_NUM_SAMPLES) {
+        set_state(GESTURE_CAPTURE_INFERRING);
+    }
+}
+
+//----------------------- Public API ------------------------
+
+void gesture_capture_init(LSM6DS3 *imu, lv_obj_t *parent, gesture_result_cb_t result_cb)
+{
+    capture_imu = imu;
+    capture_cb  = result_cb;
+
+    // Raw counts -> int8 model input without touching floats per sample
+    imu_quant_init(imu);
+
+    progress_bar = lv_bar_create(parent);
+    lv_obj_set_size(progress_bar, 100, 8);
+    lv_obj_align(progress_bar, LV_ALIGN_TOP_MID, 0, 36);
+    lv_bar_set_range(progress_bar, 0, GESTURE_NUM_SAMPLES);
+    lv_obj_clear_flag(progress_bar, LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_flag(progress_bar, LV_OBJ_FLAG_HIDDEN);
+
+    capture_timer = lv_timer_create(capture_timer_cb, GESTURE_TICK_MS, NULL);
+    set_state(GESTURE_CAPTURE_IDLE);
+}
+
+bool gesture_capture_start(void)
+{
+    if (capture_state != GESTURE_CAPTURE_IDLE || !capture_imu || gesture_stream_running()) {
+        return false;
+    }
+    if (!gesture_engine_ready()) {
+        Serial.println("Gesture engine not initialised!");
+        return false;
+    }
+
+    samples_read = 0;
+    armed_since  = millis();
+    imu_fifo_reset();   // only motion after the tap counts
+    show_progress(true);
+    set_state(GESTURE_CAPTURE_ARMED);
+    return true;
+}
+
+void gesture_capture_tick(void)
+{
+    switch (capture_state) {
+    case GESTURE_CAPTURE_IDLE:
+        break;
+
+    case GESTURE_CAPTURE_ARMED:
+        armed_slice(millis());
+        break;
+
+    case GESTURE_CAPTURE_RECORDING:
+        recording_slice();
+        break;
+
+    case GESTURE_CAPTURE_INFERRING:
+        // Invoke() gets a slice of its own so recording never shares one with it
+        gesture_engine_classify(window, &last_result);
+        set_state(GESTURE_CAPTURE_DONE);
+        break;
+
+    case GESTURE_CAPTURE_DONE:
+        show_progress(false);
+        if (capture_cb) {
+            capture_cb(&last_result);
+        }
+        set_state(GESTURE_CAPTURE_IDLE);
+        break;
+    }
+}
+
+gesture_capture_state_t gesture_capture_state(void)
+{
+    return capture_state;
+}
+
+uint16_t gesture_capture_progress(void)
+{
+    return samples_read;
+}
@@ -0,0 +1,52 @@
+#ifndef GESTURE_CAPTURE_H
+#define GESTURE_CAPTURE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include <LSM6DS3.h>
+#include "gesture_engine.h"
+#include "imu_fifo.h"
+
+// Capture tuning
+#define GESTURE_ACCEL_THRESHOLD      2.3f   // |aX|+|aY|+|aZ| in g that starts a recording
+#define GESTURE_ARM_TIMEOUT_MS       5000   // give up if no motion shows up
+#define GESTURE_TICK_MS              10     // lv_timer period driving the state machine
+
+typedef enum {
+    GESTURE_CAPTURE_IDLE = 0,
+    GESTURE_CAPTURE_ARMED,      // waiting for the threshold crossing
+    GESTURE_CAPTURE_RECORDING,  // filling the window
+    GESTURE_CAPTURE_INFERRING,  // window full, classify on the next slice
+    GESTURE_CAPTURE_DONE        // result ready, reported on the next slice
+} gesture_capture_state_t;
+
+typedef void (*gesture_result_cb_t)(const gesture_result_t *result);
+
+/**
+ * @brief Creates the progress bar and the lv_timer that advances the capture.
+ *        Must be called after lv_init() and the display setup.
+ *
+ * @param imu        the already started IMU, with imu_fifo_begin() done
+ * @param parent     object the progress bar is drawn on (usually lv_scr_act())
+ * @param result_cb  called once per finished capture, may be NULL
+ */
+void gesture_capture_init(LSM6DS3 *imu, lv_obj_t *parent, gesture_result_cb_t result_cb);
+
+/**
+ * @brief Arms a capture. Returns immediately; the recording starts once the
+ *        acceleration threshold is crossed. Ignored if a capture is running.
+ */
+bool gesture_capture_start(void);
+
+/**
+ * @brief Advances the state machine by one slice. Called from the lv_timer
+ *        created in gesture_capture_init(), but may also be called from loop().
+ */
+void gesture_capture_tick(void);
+
+gesture_capture_state_t gesture_capture_state(void);
+
+// Number of samples recorded so far in the current window (0..GESTURE_NUM_SAMPLES)
+uint16_t gesture_capture_progress(void);
+
+#endif // GESTURE_CAPTURE_H
@@ -0,0 +1,147 @@
+#include "gesture_engine.h"
+#include "event_log.h"
+#include "mem_plan.h"
+
+#include <TensorFlowLite.h>
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include <tensorflow/lite/micro/micro_error_reporter.h>
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+// Only included here so the flatbuffer lives in flash exactly once
+#include "model.h"
+
+// If your model class names differ, adapt these:
+static const char* GESTURES[GESTURE_NUM_CLASSES] = {"bow", "sleep", "circle"};
+
+// Everything the interpreter needs stays alive for the lifetime of the sketch
+static tflite::MicroErrorReporter     tflErrorReporter;
+static tflite::MicroMutableOpResolver<11> tflOpsResolver;
+static uint8_t *const tensorArena = (uint8_t *)MEM_ARENA(MEM_ARENA_TENSOR);   // 16-byte aligned
+
+static tflite::MicroInterpreter *tflInterpreter  = nullptr;
+static TfLiteTensor             *tflInputTensor  = nullptr;
+static TfLiteTensor             *tflOutputTensor = nullptr;
+
+// Cached quantisation parameters
+static float input_scale       = 1.0f;
+static int   input_zero_point  = 0;
+static float output_scale      = 1.0f;
+static int   output_zero_point = 0;
+
+static void read_quant_params(const TfLiteTensor *tensor, float *scale, int *zero_point)
+{
+    if (tensor->type != kTfLiteInt8) {
+        return;
+    }
+    auto *params = (TfLiteAffineQuantization *) tensor->quantization.params;
+    if (params) {
+        *scale      = params->scale->data[0];
+        *zero_point = params->zero_point->data[0];
+    }
+}
+
+bool gesture_engine_init(void)
+{
+    if (tflInterpreter) {
+        return true;
+    }
+
+    // Only add the ops the model needs (each one exactly once)
+    tflOpsResolver.AddFullyConnected();
+    tflOpsResolver.AddConv2D();
+    tflOpsResolver.AddMaxPool2D();
+    tflOpsResolver.AddSoftmax();
+    tflOpsResolver.AddReshape();
+    tflOpsResolver.AddRelu();
+    tflOpsResolver.AddShape();
+    tflOpsResolver.AddStridedSlice();
+    tflOpsResolver.AddPack();
+    tflOpsResolver.AddExpandDims();
+    tflOpsResolver.AddMean();
+
+    const tflite::Model *tflModel = tflite::GetModel(model);
+    if (tflModel->version() != TFLITE_SCHEMA_VERSION) {
+        Serial.print("Model schema version mismatch: ");
+        Serial.println(tflModel->version());
+        return false;
+    }
+
+    // Static storage instead of new: no heap churn, arena stays planned
+    static tflite::MicroInterpreter interpreter(tflModel, tflOpsResolver,
+                                                tensorArena, GESTURE_TENSOR_ARENA_SIZE,
+                                                &tflErrorReporter);
+    if (interpreter.AllocateTensors() != kTfLiteOk) {
+        Serial.println("AllocateTensors() failed!");
+        return false;
+    }
+
+    tflInputTensor  = interpreter.input(0);
+    tflOutputTensor = interpreter.output(0);
+    read_quant_params(tflInputTensor,  &input_scale,  &input_zero_point);
+    read_quant_params(tflOutputTensor, &output_scale, &output_zero_point);
+
+    Serial.print("Gesture engine ready, input dims: ");
+    for (int i = 0; i < tflInputTensor->dims->size; i++) {
+        Serial.print(tflInputTensor->dims->data[i]);
+        Serial.print(" ");
+    }
+    Serial.print(" arena used: ");
+    Serial.println((unsigned long) interpreter.arena_used_bytes());
+
+    tflInterpreter = &interpreter;
+    return true;
+}
+
+bool gesture_engine_ready(void)
+{
+    return tflInterpreter != nullptr;
+}
+
+float gesture_engine_input_scale(void)
+{
+    return input_scale;
+}
+
+int gesture_engine_input_zero_point(void)
+{
+    return input_zero_point;
+}
+
+bool gesture_engine_classify(const int8_t *window, gesture_result_t *result)
+{
+    result->label      = -1;
+    result->latency_us = 0;
+    if (!tflInterpreter) {
+        return false;
+    }
+
+    uint32_t start = micros();
+
+    memcpy(tflInputTensor->data.int8, window, GESTURE_WINDOW_LEN);
+    if (tflInterpreter->Invoke() != kTfLiteOk) {
+        LOG_ERROR(LOG_EV_INVOKE_FAILED);
+        return false;
+    }
+
+    int8_t best = INT8_MIN;
+    for (int i = 0; i < GESTURE_NUM_CLASSES; i++) {
+        int8_t outVal = tflOutputTensor->data.int8[i];
+        result->scores[i] = (outVal - output_zero_point) * output_scale;
+        if (outVal > best) {
+            best          = outVal;
+            result->label = i;
+        }
+    }
+
+    result->latency_us = micros() - start;
+    return true;
+}
+
+const char *gesture_engine_label(int index)
+{
+    if (index < 0 || index >= GESTURE_NUM_CLASSES) {
+        return "none";
+    }
+    return GESTURES[index];
+}
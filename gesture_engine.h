@@ -0,0 +1,46 @@
+#ifndef GESTURE_ENGINE_H
+#define GESTURE_ENGINE_H
+
+#include <Arduino.h>
+
+// Window layout expected by the model (see arduino_tinyml_workshop_quantized.ipynb)
+#define GESTURE_NUM_SAMPLES     179   // 1.5 s worth of data
+#define GESTURE_NUM_AXES        6     // aX, aY, aZ, gX, gY, gZ
+#define GESTURE_WINDOW_LEN      (GESTURE_NUM_SAMPLES * GESTURE_NUM_AXES)
+#define GESTURE_NUM_CLASSES     3
+
+// Size of the static arena TFLM plans its tensors into
+#define GESTURE_TENSOR_ARENA_SIZE (6 * 1024)
+
+typedef struct {
+    int      label;                         // index of the best class, -1 if invoke failed
+    float    scores[GESTURE_NUM_CLASSES];   // dequantised output probabilities
+    uint32_t latency_us;                    // time spent in copy + Invoke()
+} gesture_result_t;
+
+/**
+ * @brief Brings up the TFLM interpreter once: registers ops, checks the schema,
+ *        plans the tensor arena and caches the quantisation parameters.
+ *        Call from setup(). Safe to call again, later calls are no-ops.
+ *
+ * @return true if the engine is ready to classify
+ */
+bool gesture_engine_init(void);
+
+bool gesture_engine_ready(void);
+
+float gesture_engine_input_scale(void);
+int   gesture_engine_input_zero_point(void);
+
+/**
+ * @brief Runs a single inference on an already quantised window.
+ *
+ * @param window  GESTURE_WINDOW_LEN int8 values laid out sample by sample
+ * @param result  filled with scores, best label and measured latency
+ * @return true if Invoke() succeeded
+ */
+bool gesture_engine_classify(const int8_t *window, gesture_result_t *result);
+
+const char *gesture_engine_label(int index);
+
+#endif // GESTURE_ENGINE_H
@@ -0,0 +1,169 @@
+#include "gesture_stream.h"
+#include "imu_fifo.h"
+#include "imu_quant.h"
+
+static gesture_stream_config_t stream_config = {
+    GESTURE_STREAM_HOP, GESTURE_STREAM_VOTES,
+    GESTURE_STREAM_MIN_VOTES, GESTURE_STREAM_MIN_SCORE
+};
+static gesture_result_cb_t stream_cb    = NULL;
+static lv_timer_t         *stream_timer = NULL;
+static bool                running      = false;
+
+// Sliding window: the last GESTURE_NUM_SAMPLES quantised samples, circular
+static int8_t   history[GESTURE_WINDOW_LEN];
+static uint16_t write_slot    = 0;   // sample slot the next frame goes into
+static uint16_t filled        = 0;   // valid samples in history
+static uint16_t since_infer   = 0;   // samples added since the last inference
+
+// Linearised copy handed to the engine
+static int8_t   window[GESTURE_WINDOW_LEN];
+
+// Smoothing state
+static int8_t   vote_ring[GESTURE_STREAM_MAX_VOTES];
+static uint8_t  vote_next     = 0;
+static int8_t   reported      = -1;  // label last handed to stream_cb, -1 = none
+
+//----------------------- Smoothing ------------------------
+
+static void reset_votes(void)
+{
+    memset(vote_ring, -1, sizeof(vote_ring));
+    vote_next = 0;
+    reported  = -1;
+}
+
+// Majority over the last stream_config.votes outputs, -1 if nobody has enough
+static int8_t vote(int8_t label)
+{
+    vote_ring[vote_next] = label;
+    vote_next = (vote_next + 1) % stream_config.votes;
+
+    uint8_t counts[GESTURE_NUM_CLASSES] = {0};
+    for (uint8_t i = 0; i < stream_config.votes; i++) {
+        if (vote_ring[i] >= 0) {
+            counts[vote_ring[i]]++;
+        }
+    }
+
+    int8_t winner = -1;
+    for (int8_t c = 0; c < GESTURE_NUM_CLASSES; c++) {
+        if (counts[c] >= stream_config.min_votes &&
+            (winner < 0 || counts[c] > counts[winner])) {
+            winner = c;
+        }
+    }
+    return winner;
+}
+
+//----------------------- Window handling ------------------------
+
+static void classify_window(void)
+{
+    // Oldest sample first: [write_slot, end) then [0, write_slot)
+    size_t split = (size_t)write_slot * GESTURE_NUM_AXES;
+    memcpy(window, &history[split], GESTURE_WINDOW_LEN - split);
+    memcpy(&window[GESTURE_WINDOW_LEN - split], history, split);
+
+    gesture_result_t result;
+    if (!gesture_engine_classify(window, &result)) {
+        return;
+    }
+
+    int8_t label = (int8_t)result.label;
+    if (result.scores[label] < stream_config.min_score) {
+        label = -1;
+    }
+
+    // Hysteresis: a label is reported once when it starts winning the vote,
+    // and can only be reported again after something else has won
+    int8_t winner = vote(label);
+    if (winner != reported) {
+        reported = winner;
+        if (winner >= 0 && stream_cb) {
+            result.label = winner;
+            stream_cb(&result);
+        }
+    }
+}
+
+static void stream_timer_cb(lv_timer_t *timer)
+{
+    gesture_stream_tick();
+}
+
+//----------------------- Public API ------------------------
+
+void gesture_stream_init(const gesture_stream_config_t *config, gesture_result_cb_t result_cb)
+{
+    if (config) {
+        stream_config = *config;
+    }
+    if (stream_config.hop == 0 || stream_config.hop > GESTURE_NUM_SAMPLES) {
+        stream_config.hop = GESTURE_STREAM_HOP;
+    }
+    if (stream_config.votes == 0 || stream_config.votes > GESTURE_STREAM_MAX_VOTES) {
+        stream_config.votes = GESTURE_STREAM_VOTES;
+    }
+    // 0 would report every window's output, more than the window can never be reached
+    stream_config.min_votes = constrain(stream_config.min_votes, 1, stream_config.votes);
+    stream_cb = result_cb;
+
+    stream_timer = lv_timer_create(stream_timer_cb, GESTURE_TICK_MS, NULL);
+    lv_timer_pause(stream_timer);
+}
+
+void gesture_stream_start(void)
+{
+    if (running || !gesture_engine_ready() || gesture_capture_state() != GESTURE_CAPTURE_IDLE) {
+        return;
+    }
+
+    write_slot  = 0;
+    filled      = 0;
+    since_infer = 0;
+    reset_votes();
+    imu_fifo_reset();
+
+    running = true;
+    lv_timer_resume(stream_timer);
+}
+
+void gesture_stream_stop(void)
+{
+    running = false;
+    if (stream_timer) {
+        lv_timer_pause(stream_timer);
+    }
+}
+
+bool gesture_stream_running(void)
+{
+    return running;
+}
+
+void gesture_stream_tick(void)
+{
+    if (!running) {
+        return;
+    }
+
+    imu_fifo_drain();
+
+    imu_frame_t frame;
+    while (imu_ring_pop(&frame)) {
+        imu_quant_frame(&frame, &history[write_slot * GESTURE_NUM_AXES]);
+        write_slot = (write_slot + 1) % GESTURE_NUM_SAMPLES;
+        if (filled < GESTURE_NUM_SAMPLES) {
+            filled++;
+        }
+        since_infer++;
+
+        // At most one inference per slice; leftover frames wait in the ring
+        if (filled == GESTURE_NUM_SAMPLES && since_infer >= stream_config.hop) {
+            since_infer = 0;
+            classify_window();
+            return;
+        }
+    }
+}
@@ -0,0 +1,48 @@
+#ifndef GESTURE_STREAM_H
+#define GESTURE_STREAM_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "gesture_engine.h"
+#include "gesture_capture.h"
+
+// Set to 1 to recognise gestures continuously instead of arming a capture
+// from the bed animation
+#ifndef GESTURE_STREAM_MODE
+#define GESTURE_STREAM_MODE 0
+#endif
+
+// Streaming defaults
+#define GESTURE_STREAM_HOP          30     // samples between two inferences (~290 ms at 104 Hz)
+#define GESTURE_STREAM_VOTES        3      // how many recent outputs take part in the vote
+#define GESTURE_STREAM_MIN_VOTES    2      // votes a label needs to be reported
+#define GESTURE_STREAM_MIN_SCORE    0.70f  // an output below this counts as "no gesture"
+#define GESTURE_STREAM_MAX_VOTES    8
+
+typedef struct {
+    uint16_t hop;        // samples between inferences, 1..GESTURE_NUM_SAMPLES
+    uint8_t  votes;      // size of the vote window, 1..GESTURE_STREAM_MAX_VOTES
+    uint8_t  min_votes;  // majority needed to report a label, clamped to 1..votes
+    float    min_score;  // confidence below which an output is treated as none
+} gesture_stream_config_t;
+
+/**
+ * @brief Sets up the sliding window and the lv_timer that feeds it.
+ *
+ * @param config     tuning, NULL for the GESTURE_STREAM_* defaults
+ * @param result_cb  called once per detected gesture (after smoothing)
+ */
+void gesture_stream_init(const gesture_stream_config_t *config, gesture_result_cb_t result_cb);
+
+// Starts / stops streaming. While running, gesture_capture_start() is refused.
+void gesture_stream_start(void);
+void gesture_stream_stop(void);
+bool gesture_stream_running(void);
+
+/**
+ * @brief Pulls new IMU frames into the window and, every hop, classifies the
+ *        last GESTURE_NUM_SAMPLES samples. Driven by the stream's lv_timer.
+ */
+void gesture_stream_tick(void);
+
+#endif // GESTURE_STREAM_H
@@ -0,0 +1,335 @@
+#include "heap_stats.h"
+#include <lvgl.h>
+
+#if defined(ESP32)
+#include <esp_heap_caps.h>
+#elif defined(__NEWLIB__) || defined(__GLIBC__)
+#include <malloc.h>
+#include <unistd.h>
+#endif
+
+#if defined(ARDUINO_ARCH_NRF52) || defined(ARDUINO_ARCH_MBED)
+// Heap bounds from the linker script
+extern "C" char __HeapBase[];
+extern "C" char __HeapLimit[];
+#define HEAP_HAS_BOUNDS 1
+#else
+#define HEAP_HAS_BOUNDS 0
+#endif
+
+#define HEAP_TAG_NAME(id, name) name,
+static const char *tag_names[HEAP_TAG_COUNT] = { HEAP_TAGS(HEAP_TAG_NAME) };
+#undef HEAP_TAG_NAME
+
+static heap_tag_stats_t tags[HEAP_TAG_COUNT];
+static heap_tag_stats_t totals;
+static uint32_t         break_peak = 0;
+
+//----------------------- Allocator stats ------------------------
+
+#if HEAP_HAS_BOUNDS && defined(__NEWLIB__)
+/*
+  newlib doesn't report its largest free chunk, so it is read off the free
+  lists. Both are weak: newlib-nano links __malloc_free_list, full newlib
+  __malloc_av_, and only the one in use resolves.
+*/
+struct nano_chunk_t {
+    long          size;        // whole chunk, header included
+    nano_chunk_t *next;
+};
+
+struct full_chunk_t {
+    size_t        prev_size;
+    size_t        size;        // whole chunk; the low two bits are flags
+    full_chunk_t *fd;
+    full_chunk_t *bk;
+};
+
+// Bins in full newlib's av_[], bin 0 being top
+#define FULL_NEWLIB_BINS 128
+
+extern "C" nano_chunk_t *__malloc_free_list __attribute__((weak));
+extern "C" full_chunk_t *__malloc_av_[] __attribute__((weak));
+
+// Payload of a chunk, 0 for one that is all header
+static uint32_t chunk_payload(uint32_t size, uint32_t header)
+{
+    return size > header ? size - header : 0;
+}
+
+/*
+  Largest malloc() the free lists plus the space above the break can serve.
+  False if neither list is linked in (a malloc this doesn't know).
+*/
+static bool largest_listed_chunk(uint32_t headroom, uint32_t *largest)
+{
+    uint32_t best = headroom;
+
+    if (&__malloc_free_list) {
+        __malloc_lock(_REENT);
+        for (nano_chunk_t *c = __malloc_free_list; c; c = c->next) {
+            best = LV_MAX(best, chunk_payload((uint32_t)c->size, sizeof(long)));
+        }
+        __malloc_unlock(_REENT);
+    } else if (__malloc_av_) {
+        __malloc_lock(_REENT);
+        for (int i = 1; i < FULL_NEWLIB_BINS; i++) {
+            full_chunk_t *bin = (full_chunk_t *)((char *)&__malloc_av_[2 * i + 2] - 2 * sizeof(size_t));
+            for (full_chunk_t *c = bin->fd; c != bin; c = c->fd) {
+                best = LV_MAX(best, chunk_payload(c->size & ~3u, sizeof(size_t)));
+            }
+        }
+        // Top ends at the break and grows into the headroom
+        full_chunk_t *top = __malloc_av_[2];
+        best = LV_MAX(best, chunk_payload(top->size & ~3u, sizeof(size_t)) + headroom);
+        __malloc_unlock(_REENT);
+    } else {
+        return false;
+    }
+
+    *largest = best;
+    return true;
+}
+#endif
+
+void heap_stats_get(heap_stats_t *stats)
+{
+    memset(stats, 0, sizeof(*stats));
+
+#if defined(ESP32)
+    multi_heap_info_t info;
+    heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+    stats->total        = info.total_free_bytes + info.total_allocated_bytes;
+    stats->free         = info.total_free_bytes;
+    stats->largest_free = info.largest_free_block;
+    stats->largest_exact = true;
+    stats->high_water   = stats->total - info.minimum_free_bytes;
+#elif defined(__NEWLIB__) || defined(__GLIBC__)
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    struct mallinfo2 mi = mallinfo2();
+#else
+    struct mallinfo mi = mallinfo();
+#endif
+    // arena is what malloc has taken with sbrk; newlib-nano never gives it back
+    if ((uint32_t)mi.arena > break_peak) {
+        break_peak = mi.arena;
+    }
+    stats->high_water = break_peak;
+#if HEAP_HAS_BOUNDS
+    uint32_t headroom   = (uint32_t)(__HeapLimit - (char *)sbrk(0));
+    stats->total        = (uint32_t)(__HeapLimit - __HeapBase);
+    stats->free         = mi.fordblks + headroom;
+#if defined(__NEWLIB__)
+    stats->largest_exact = largest_listed_chunk(headroom, &stats->largest_free);
+#endif
+    if (!stats->largest_exact) {
+        stats->largest_free = LV_MAX(headroom, (uint32_t)mi.keepcost);
+    }
+#else
+    stats->total        = mi.arena;
+    stats->free         = mi.fordblks;
+    stats->largest_free = mi.keepcost;
+#endif
+#endif
+
+    // A lower bound for the largest block would make any heap look fragmented
+    if (stats->largest_exact && stats->free > 0) {
+        stats->fragmentation = 100 - (uint8_t)((uint64_t)stats->largest_free * 100 / stats->free);
+    }
+}
+
+//----------------------- Tracking ------------------------
+
+#if HEAP_TRACK
+// Sits in front of every tracked block; 8 bytes keeps the payload aligned
+typedef struct {
+    uint32_t size;
+    uint32_t tag;
+} heap_header_t;
+
+static void charge_one(heap_tag_stats_t *t, uint32_t size)
+{
+    t->allocs++;
+    t->bytes += size;
+    if (t->bytes > t->peak) {
+        t->peak = t->bytes;
+    }
+}
+
+static void charge(heap_tag_t tag, uint32_t size)
+{
+    charge_one(&tags[tag], size);
+    charge_one(&totals, size);
+}
+
+static void release(heap_tag_t tag, uint32_t size)
+{
+    tags[tag].frees++;
+    tags[tag].bytes -= size;
+    totals.frees++;
+    totals.bytes -= size;
+}
+
+void *heap_malloc(heap_tag_t tag, size_t size)
+{
+    heap_header_t *header = (heap_header_t *)malloc(sizeof(heap_header_t) + size);
+    if (!header) {
+        tags[tag].failures++;
+        totals.failures++;
+        return NULL;
+    }
+    header->size = size;
+    header->tag  = tag;
+    charge(tag, size);
+    return header + 1;
+}
+
+void *heap_realloc(heap_tag_t tag, void *ptr, size_t size)
+{
+    if (!ptr) {
+        return heap_malloc(tag, size);
+    }
+    if (size == 0) {
+        heap_free(ptr);
+        return NULL;
+    }
+
+    heap_header_t *header   = (heap_header_t *)ptr - 1;
+    heap_tag_t     old_tag  = (heap_tag_t)header->tag;
+    uint32_t       old_size = header->size;
+
+    heap_header_t *grown = (heap_header_t *)realloc(header, sizeof(heap_header_t) + size);
+    if (!grown) {
+        tags[tag].failures++;
+        totals.failures++;
+        return NULL;   // the old block is untouched and still charged
+    }
+    release(old_tag, old_size);
+    grown->size = size;
+    grown->tag  = tag;
+    charge(tag, size);
+    return grown + 1;
+}
+
+void heap_free(void *ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    heap_header_t *header = (heap_header_t *)ptr - 1;
+    release((heap_tag_t)header->tag, header->size);
+    free(header);
+}
+#else
+void *heap_malloc(heap_tag_t tag, size_t size)
+{
+    void *ptr = malloc(size);
+    if (!ptr) {
+        tags[tag].failures++;
+        totals.failures++;
+    }
+    return ptr;
+}
+
+void *heap_realloc(heap_tag_t tag, void *ptr, size_t size)
+{
+    void *grown = realloc(ptr, size);
+    if (!grown && size) {
+        tags[tag].failures++;
+        totals.failures++;
+    }
+    return grown;
+}
+
+void heap_free(void *ptr)
+{
+    free(ptr);
+}
+#endif
+
+const heap_tag_stats_t *heap_tag_stats(heap_tag_t tag)
+{
+    return &tags[tag];
+}
+
+const heap_tag_stats_t *heap_total_stats(void)
+{
+    return &totals;
+}
+
+const char *heap_tag_name(heap_tag_t tag)
+{
+    return (tag < HEAP_TAG_COUNT) ? tag_names[tag] : "?";
+}
+
+extern "C" void *heap_lvgl_malloc(size_t size)
+{
+    return heap_malloc(HEAP_TAG_LVGL, size);
+}
+
+extern "C" void *heap_lvgl_realloc(void *ptr, size_t size)
+{
+    return heap_realloc(HEAP_TAG_LVGL, ptr, size);
+}
+
+extern "C" void heap_lvgl_free(void *ptr)
+{
+    heap_free(ptr);
+}
+
+//----------------------- Report ------------------------
+
+void heap_print(void)
+{
+    heap_stats_t stats;
+    heap_stats_get(&stats);
+
+    Serial.print("heap: total ");
+    Serial.print(stats.total);
+    Serial.print(" free ");
+    Serial.print(stats.free);
+    Serial.print(" largest ");
+    Serial.print(stats.largest_free);
+    Serial.print(stats.largest_exact ? " high-water " : "+ high-water ");
+    Serial.print(stats.high_water);
+    Serial.print(" frag ");
+    if (stats.largest_exact) {
+        Serial.print(stats.fragmentation);
+        Serial.println("%");
+    } else {
+        Serial.println("?");
+    }
+
+    for (int i = 0; i < HEAP_TAG_COUNT; i++) {
+        const heap_tag_stats_t *t = &tags[i];
+        Serial.print("  ");
+        Serial.print(tag_names[i]);
+        Serial.print(": ");
+        Serial.print(t->bytes);
+        Serial.print(" B live, peak ");
+        Serial.print(t->peak);
+        Serial.print(", ");
+        Serial.print(t->allocs);
+        Serial.print(" allocs / ");
+        Serial.print(t->frees);
+        Serial.print(" frees / ");
+        Serial.print(t->failures);
+        Serial.println(" failed");
+    }
+
+    // LVGL's built-in pool is a static array, not heap
+#if (LVGL_VERSION_MAJOR == 8 && LV_MEM_CUSTOM == 0) || \
+    (LVGL_VERSION_MAJOR == 9 && LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN)
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    Serial.print("  lvgl pool: ");
+    Serial.print((unsigned long)(mon.total_size - mon.free_size));
+    Serial.print(" of ");
+    Serial.print((unsigned long)mon.total_size);
+    Serial.print(" B used, peak ");
+    Serial.print((unsigned long)mon.max_used);
+    Serial.print(", frag ");
+    Serial.print(mon.frag_pct);
+    Serial.println("%");
+#endif
+}
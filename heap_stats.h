@@ -0,0 +1,90 @@
+#ifndef HEAP_STATS_H
+#define HEAP_STATS_H
+
+#include <Arduino.h>
+
+// Set to 0 to make heap_malloc() & co plain malloc() with no size header
+#ifndef HEAP_TRACK
+#define HEAP_TRACK 1
+#endif
+
+/*
+  Subsystems allocations are charged to: id, then the name heap_print() uses.
+  LVGL is only charged when lv_conf.h routes its allocator here (see below).
+*/
+#define HEAP_TAGS(X) \
+    X(HEAP_TAG_APP,  "app")  \
+    X(HEAP_TAG_LVGL, "lvgl") \
+    X(HEAP_TAG_TFLM, "tflm")
+
+#define HEAP_TAG_ENUM(id, name) id,
+typedef enum {
+    HEAP_TAGS(HEAP_TAG_ENUM)
+    HEAP_TAG_COUNT
+} heap_tag_t;
+#undef HEAP_TAG_ENUM
+
+typedef struct {
+    uint32_t total;           // size of the heap region, 0 if the platform doesn't say
+    uint32_t free;            // free chunks plus untouched space above the break
+    uint32_t largest_free;    // biggest single malloc() that would succeed
+    uint32_t high_water;      // most of the heap ever claimed
+    uint8_t  fragmentation;   // percent of the free bytes outside the largest block
+    bool     largest_exact;   // false: largest_free is a lower bound, fragmentation 0
+} heap_stats_t;
+
+typedef struct {
+    uint32_t bytes;           // live, payload only
+    uint32_t peak;
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t failures;
+} heap_tag_stats_t;
+
+/**
+ * @brief Diagnostic: reads the allocator's own bookkeeping, heap_caps_get_info()
+ *        on ESP32, mallinfo() plus the linker's heap bounds on newlib. Nothing
+ *        is allocated, so it is safe right before a large allocation.
+ *
+ *        newlib doesn't track its largest free chunk; it is found by walking
+ *        the free lists under the malloc lock. Where those aren't known (no
+ *        heap bounds, another malloc) largest_free is the bigger of the top
+ *        chunk and the space above the break, a lower bound, and
+ *        fragmentation isn't worked out.
+ *
+ *        Both mallinfo() and the walk cost O(free chunks) with malloc locked,
+ *        so this is for setup() and heap_print(); anything that runs while
+ *        animating reads heap_total_stats() instead.
+ */
+void heap_stats_get(heap_stats_t *stats);
+
+// malloc / realloc / free that charge the block to a subsystem
+void *heap_malloc(heap_tag_t tag, size_t size);
+void *heap_realloc(heap_tag_t tag, void *ptr, size_t size);
+void  heap_free(void *ptr);
+
+const heap_tag_stats_t *heap_tag_stats(heap_tag_t tag);
+
+// All tags together, kept up to date by the wrappers above; O(1)
+const heap_tag_stats_t *heap_total_stats(void);
+const char *heap_tag_name(heap_tag_t tag);
+
+// Prints the heap stats and one line per tag
+void heap_print(void);
+
+/*
+  LVGL's allocator hooks. With LV_MEM_CUSTOM 1 in lv_conf.h (v8):
+    #define LV_MEM_CUSTOM_INCLUDE  <stddef.h>
+    #define LV_MEM_CUSTOM_ALLOC    heap_lvgl_malloc
+    #define LV_MEM_CUSTOM_FREE     heap_lvgl_free
+    #define LV_MEM_CUSTOM_REALLOC  heap_lvgl_realloc
+  and the three prototypes declared extern "C" there. With the built-in pool
+  heap_print() reports lv_mem_monitor() instead.
+*/
+extern "C" {
+void *heap_lvgl_malloc(size_t size);
+void *heap_lvgl_realloc(void *ptr, size_t size);
+void  heap_lvgl_free(void *ptr);
+}
+
+#endif // HEAP_STATS_H
@@ -0,0 +1,232 @@
+#include "hit_regions.h"
+#include "touch_events.h"
+#include "heap_stats.h"
+
+//----------------------- Registry ------------------------
+
+bool hit_registry_init(hit_registry_t *reg, uint16_t capacity)
+{
+    memset(reg, 0, sizeof(*reg));
+    reg->regions = (hit_region_t *)heap_malloc(HEAP_TAG_APP, (size_t)capacity * sizeof(hit_region_t));
+    if (!reg->regions) {
+        return false;
+    }
+    reg->capacity = capacity;
+    reg->dirty    = true;
+    return true;
+}
+
+void hit_registry_free(hit_registry_t *reg)
+{
+    heap_free(reg->regions);
+    heap_free(reg->cell_items);
+    memset(reg, 0, sizeof(*reg));
+}
+
+void hit_registry_clear(hit_registry_t *reg)
+{
+    reg->count = 0;
+    reg->dirty = true;
+}
+
+static hit_region_t *add_region(hit_registry_t *reg, int16_t *id)
+{
+    if (reg->count >= reg->capacity) {
+        *id = HIT_NONE;
+        return NULL;
+    }
+    *id = reg->count;
+    hit_region_t *region = &reg->regions[reg->count++];
+    memset(region, 0, sizeof(*region));
+    reg->dirty = true;
+    return region;
+}
+
+int16_t hit_add_rect(hit_registry_t *reg, int x_min, int x_max, int y_min, int y_max)
+{
+    int16_t id;
+    hit_region_t *region = add_region(reg, &id);
+    if (region) {
+        region->shape = HIT_SHAPE_RECT;
+        region->x_min = x_min;
+        region->x_max = x_max;
+        region->y_min = y_min;
+        region->y_max = y_max;
+    }
+    return id;
+}
+
+int16_t hit_add_circle(hit_registry_t *reg, int center_x, int center_y, int radius)
+{
+    int16_t id;
+    hit_region_t *region = add_region(reg, &id);
+    if (region) {
+        region->shape    = HIT_SHAPE_CIRCLE;
+        region->center_x = center_x;
+        region->center_y = center_y;
+        region->radius   = radius;
+        region->x_min    = center_x - radius;
+        region->x_max    = center_x + radius;
+        region->y_min    = center_y - radius;
+        region->y_max    = center_y + radius;
+    }
+    return id;
+}
+
+void hit_bind_anim(hit_registry_t *reg, int16_t id,
+                   pivot_sprite_t  *sprites,
+                   uint16_t         sprite_count,
+                   int32_t         *current_angle,
+                   sprite_anim_cb_t anim_func,
+                   int32_t          end_angle_offset,
+                   uint32_t         duration,
+                   bool             infinite)
+{
+    if (id < 0 || id >= reg->count) {
+        return;
+    }
+    hit_region_t *region = &reg->regions[id];
+    region->anim             = anim_func;
+    region->sprites          = sprites;
+    region->sprite_count     = sprite_count;
+    region->current_angle    = current_angle;
+    region->end_angle_offset = end_angle_offset;
+    region->duration         = duration;
+    region->infinite         = infinite;
+}
+
+//----------------------- Grid index ------------------------
+
+// Cell range a region's bounding box covers, clipped to the screen
+static bool cell_span(const hit_region_t *region, int *c0, int *c1, int *r0, int *r1)
+{
+    if (region->x_max < 0 || region->y_max < 0 ||
+        region->x_min >= SCREEN_WIDTH || region->y_min >= SCREEN_HEIGHT) {
+        return false;
+    }
+    *c0 = LV_MAX(region->x_min, 0) / HIT_GRID_CELL;
+    *c1 = LV_MIN(region->x_max, SCREEN_WIDTH - 1) / HIT_GRID_CELL;
+    *r0 = LV_MAX(region->y_min, 0) / HIT_GRID_CELL;
+    *r1 = LV_MIN(region->y_max, SCREEN_HEIGHT - 1) / HIT_GRID_CELL;
+    return true;
+}
+
+static bool rebuild_index(hit_registry_t *reg)
+{
+    // 1) Count the regions of every cell
+    uint16_t *start = reg->cell_start;
+    memset(start, 0, sizeof(reg->cell_start));
+    for (uint16_t i = 0; i < reg->count; i++) {
+        int c0, c1, r0, r1;
+        if (!cell_span(&reg->regions[i], &c0, &c1, &r0, &r1)) {
+            continue;
+        }
+        for (int r = r0; r <= r1; r++) {
+            for (int c = c0; c <= c1; c++) {
+                start[r * HIT_GRID_COLS + c + 1]++;
+            }
+        }
+    }
+
+    // 2) Counts -> offsets
+    for (uint16_t c = 0; c < HIT_GRID_CELLS; c++) {
+        start[c + 1] += start[c];
+    }
+    uint32_t total = start[HIT_GRID_CELLS];
+    if (total > reg->items_size) {
+        uint16_t *grown = (uint16_t *)heap_realloc(HEAP_TAG_APP, reg->cell_items, total * sizeof(uint16_t));
+        if (!grown) {
+            return false;
+        }
+        reg->cell_items = grown;
+        reg->items_size = total;
+    }
+
+    // 3) Fill in id order, so the last entry of a cell is the top-most region.
+    //    Static: a cursor per cell is too much for loop()'s stack
+    static uint16_t fill[HIT_GRID_CELLS];
+    memcpy(fill, start, sizeof(fill));
+    for (uint16_t i = 0; i < reg->count; i++) {
+        int c0, c1, r0, r1;
+        if (!cell_span(&reg->regions[i], &c0, &c1, &r0, &r1)) {
+            continue;
+        }
+        for (int r = r0; r <= r1; r++) {
+            for (int c = c0; c <= c1; c++) {
+                reg->cell_items[fill[r * HIT_GRID_COLS + c]++] = i;
+            }
+        }
+    }
+
+    reg->dirty = false;
+    return true;
+}
+
+//----------------------- Lookup ------------------------
+
+// Same tests as is_within_circle_bounds() / is_within_square_bounds(), kept
+// inline for the lookup loops
+static inline bool region_contains(const hit_region_t *region, lv_coord_t x, lv_coord_t y)
+{
+    if (region->shape == HIT_SHAPE_CIRCLE) {
+        int dx = x - region->center_x;
+        int dy = y - region->center_y;
+        return dx * dx + dy * dy <= (int)region->radius * region->radius;
+    }
+    return x >= region->x_min && x <= region->x_max && y >= region->y_min && y <= region->y_max;
+}
+
+int16_t hit_find(hit_registry_t *reg, lv_coord_t x, lv_coord_t y)
+{
+    if (x < 0 || y < 0 || x >= SCREEN_WIDTH || y >= SCREEN_HEIGHT) {
+        return HIT_NONE;
+    }
+    if (reg->dirty && !rebuild_index(reg)) {
+        return hit_find_linear(reg, x, y);
+    }
+
+    uint16_t cell = (y / HIT_GRID_CELL) * HIT_GRID_COLS + x / HIT_GRID_CELL;
+    for (uint16_t k = reg->cell_start[cell + 1]; k > reg->cell_start[cell]; k--) {
+        uint16_t id = reg->cell_items[k - 1];
+        if (region_contains(&reg->regions[id], x, y)) {
+            return id;
+        }
+    }
+    return HIT_NONE;
+}
+
+int16_t hit_find_linear(const hit_registry_t *reg, lv_coord_t x, lv_coord_t y)
+{
+    for (int16_t id = reg->count - 1; id >= 0; id--) {
+        if (region_contains(&reg->regions[id], x, y)) {
+            return id;
+        }
+    }
+    return HIT_NONE;
+}
+
+int16_t hit_dispatch(hit_registry_t *reg)
+{
+    const touch_event_t *events;
+    uint8_t count = touch_frame_events(&events);
+
+    // Only contacts that start this pass, where they start; a held finger
+    // must not restart the animation on every pass
+    int16_t hit = HIT_NONE;
+    for (uint8_t i = 0; i < count; i++) {
+        if (events[i].type != TOUCH_EV_DOWN) {
+            continue;
+        }
+        int16_t id = hit_find(reg, events[i].x, events[i].y);
+        if (id == HIT_NONE) {
+            continue;
+        }
+        hit = id;
+        const hit_region_t *region = &reg->regions[id];
+        if (region->anim) {
+            region->anim(region->sprites, region->sprite_count, region->current_angle,
+                         region->end_angle_offset, region->duration, region->infinite);
+        }
+    }
+    return hit;
+}
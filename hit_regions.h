@@ -0,0 +1,87 @@
+#ifndef HIT_REGIONS_H
+#define HIT_REGIONS_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "animations.h"
+
+// Grid index over the screen; a touch only tests the regions of its cell
+#define HIT_GRID_CELL   16                                    // pixels per cell side
+#define HIT_GRID_COLS   ((SCREEN_WIDTH  + HIT_GRID_CELL - 1) / HIT_GRID_CELL)
+#define HIT_GRID_ROWS   ((SCREEN_HEIGHT + HIT_GRID_CELL - 1) / HIT_GRID_CELL)
+#define HIT_GRID_CELLS  (HIT_GRID_COLS * HIT_GRID_ROWS)
+
+#define HIT_NONE        (-1)
+
+typedef enum {
+    HIT_SHAPE_RECT = 0,
+    HIT_SHAPE_CIRCLE
+} hit_shape_t;
+
+typedef struct {
+    uint8_t    shape;                          // hit_shape_t
+    lv_coord_t x_min, x_max, y_min, y_max;     // rectangle, or the circle's bounding box
+    lv_coord_t center_x, center_y, radius;     // circles only
+
+    // What a touch inside dispatches; anim == NULL just reports the hit
+    sprite_anim_cb_t anim;
+    pivot_sprite_t  *sprites;
+    uint16_t         sprite_count;
+    int32_t         *current_angle;
+    int32_t          end_angle_offset;
+    uint32_t         duration;
+    bool             infinite;
+} hit_region_t;
+
+typedef struct {
+    hit_region_t *regions;
+    uint16_t      count;
+    uint16_t      capacity;
+
+    // Regions per cell, packed: cell c owns cell_items[cell_start[c] .. cell_start[c + 1])
+    uint16_t  cell_start[HIT_GRID_CELLS + 1];
+    uint16_t *cell_items;
+    uint32_t  items_size;
+    bool      dirty;                           // index needs a rebuild before the next lookup
+} hit_registry_t;
+
+/**
+ * @brief Allocates room for 'capacity' regions. Returns false if that doesn't fit.
+ */
+bool hit_registry_init(hit_registry_t *reg, uint16_t capacity);
+void hit_registry_free(hit_registry_t *reg);
+void hit_registry_clear(hit_registry_t *reg);
+
+// Return the new region's id, or HIT_NONE when the registry is full
+int16_t hit_add_rect(hit_registry_t *reg, int x_min, int x_max, int y_min, int y_max);
+int16_t hit_add_circle(hit_registry_t *reg, int center_x, int center_y, int radius);
+
+// Same arguments touch_anim() takes
+void hit_bind_anim(hit_registry_t *reg, int16_t id,
+                   pivot_sprite_t  *sprites,
+                   uint16_t         sprite_count,
+                   int32_t         *current_angle,
+                   sprite_anim_cb_t anim_func,
+                   int32_t          end_angle_offset,
+                   uint32_t         duration,
+                   bool             infinite);
+
+/**
+ * @brief Region under (x, y). Where regions overlap the one added last wins,
+ *        like LVGL's z order. Rebuilds the grid first if regions changed.
+ */
+int16_t hit_find(hit_registry_t *reg, lv_coord_t x, lv_coord_t y);
+
+// Reference lookup testing every region in turn, for the benchmark
+int16_t hit_find_linear(const hit_registry_t *reg, lv_coord_t x, lv_coord_t y);
+
+/**
+ * @brief Resolves every DOWN of this pass's events (touch_events_update()) to
+ *        a region and runs its animation once per press; holding or moving
+ *        the finger doesn't fire it again.
+ *
+ * @return id of the last region pressed, HIT_NONE if no press started in one
+ */
+int16_t hit_dispatch(hit_registry_t *reg);
+
+#endif // HIT_REGIONS_H
@@ -0,0 +1,150 @@
+// Host-side stand-in for the Arduino core.
+//
+// Just what the sketch and its modules call: Serial (to stdout), the time
+// functions on host_clock, pin I/O that goes nowhere and the odd helper.
+// ARDUINO is deliberately left undefined so code with a host branch (the
+// profiler's tick source) takes it.
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_clock.h"
+
+typedef uint8_t byte;
+typedef bool    boolean;
+
+#define HIGH 1
+#define LOW  0
+
+#define INPUT        0
+#define OUTPUT       1
+#define INPUT_PULLUP 2
+
+#define CHANGE  1
+#define FALLING 2
+#define RISING  3
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+#define PI         3.14159265358979323846
+#define DEG_TO_RAD 0.017453292519943295
+#define RAD_TO_DEG 57.29577951308232
+
+// XIAO pin names; nothing is wired on the host
+enum { D0, D1, D2, D3, D4, D5, D6, D7, D8, D9, D10 };
+
+//----------------------- Serial ------------------------
+
+class HostSerial {
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    void end() {}
+    void flush() { fflush(stdout); }
+    int  availableForWrite() { return 4096; }
+    operator bool() const { return true; }
+
+    size_t write(uint8_t c) { return fputc(c, stdout) == EOF ? 0 : 1; }
+    size_t write(const uint8_t *buf, size_t len) { return fwrite(buf, 1, len, stdout); }
+
+    size_t print(const char *s)  { return fputs(s, stdout) == EOF ? 0 : strlen(s); }
+    size_t print(char c)         { return write((uint8_t)c); }
+    size_t print(unsigned char v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(int v, int base = DEC)           { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC)  { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC)
+    {
+        return base == DEC ? printf("%ld", v) : print((unsigned long)v, base);
+    }
+    size_t print(unsigned long v, int base = DEC)
+    {
+        if (base == HEX) {
+            return printf("%lX", v);
+        }
+        if (base == BIN) {
+            char bits[33];
+            int  n = 0;
+            do {
+                bits[n++] = '0' + (v & 1);
+                v >>= 1;
+            } while (v && n < 32);
+            for (int i = n - 1; i >= 0; i--) {
+                fputc(bits[i], stdout);
+            }
+            return n;
+        }
+        return printf("%lu", v);
+    }
+    size_t print(long long v)          { return printf("%lld", v); }
+    size_t print(unsigned long long v) { return printf("%llu", v); }
+    size_t print(double v, int digits = 2) { return printf("%.*f", digits, v); }
+
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(T v) { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(T v, int fmt) { size_t n = print(v, fmt); return n + println(); }
+};
+
+extern HostSerial Serial;
+
+//----------------------- Time ------------------------
+
+static inline unsigned long micros(void)
+{
+    return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        host_clock::now().time_since_epoch()).count();
+}
+
+static inline unsigned long millis(void)
+{
+    return (unsigned long)(uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(
+        host_clock::now().time_since_epoch()).count();
+}
+
+// Skipped, not slept; see host_clock.h. host_realtime makes them wait.
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+extern bool host_realtime;
+
+// Runs after every delay(); replayed inputs hang off it to move with the clock
+extern void (*host_delay_hook)(void);
+
+static inline void yield(void) {}
+
+//----------------------- Pins and interrupts ------------------------
+
+static inline void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+static inline void digitalWrite(uint8_t pin, uint8_t val) { (void)pin; (void)val; }
+static inline int  digitalRead(uint8_t pin) { (void)pin; return HIGH; }
+static inline int  digitalPinToInterrupt(uint8_t pin) { return pin; }
+
+// The chsc6x fake raises touch reports itself, so there is nothing to attach
+static inline void attachInterrupt(int irq, void (*isr)(void), int mode) { (void)irq; (void)isr; (void)mode; }
+static inline void detachInterrupt(int irq) { (void)irq; }
+static inline void noInterrupts(void) {}
+static inline void interrupts(void) {}
+
+//----------------------- Helpers ------------------------
+
+template <typename T, typename L, typename H>
+static inline T constrain(T x, L lo, H hi)
+{
+    return x < (T)lo ? (T)lo : (x > (T)hi ? (T)hi : x);
+}
+
+static inline long map(long x, long in_min, long in_max, long out_min, long out_max)
+{
+    return (x - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static inline long random(long max) { return max > 0 ? rand() % max : 0; }
+static inline long random(long min, long max) { return max > min ? min + rand() % (max - min) : min; }
+static inline void randomSeed(unsigned long seed) { srand((unsigned)seed); }
+
+#endif // HOST_ARDUINO_H
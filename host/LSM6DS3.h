@@ -0,0 +1,266 @@
+// Host-side stand-in for the Seeed LSM6DS3 Arduino library.
+//
+// Replays accelerometer/gyro recordings in the notebook's CSV layout
+// (aX,aY,aZ,gX,gY,gZ with a header row, g and deg/s) through the same
+// register interface imu_fifo.cpp talks to, so the FIFO drain/decode path
+// runs unmodified off-target.
+#ifndef HOST_LSM6DS3_H
+#define HOST_LSM6DS3_H
+
+#include <stdint.h>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "host_clock.h"
+
+#define I2C_MODE 0
+#define SPI_MODE 1
+
+typedef enum {
+    IMU_SUCCESS,
+    IMU_HW_ERROR,
+    IMU_NOT_SUPPORTED,
+    IMU_GENERIC_ERROR,
+    IMU_OUT_OF_BOUNDS,
+    IMU_ALL_ONES_WARNING,
+} status_t;
+
+struct SensorSettings {
+    uint8_t  gyroEnabled        = 1;
+    uint16_t gyroRange          = 2000;
+    uint16_t gyroSampleRate     = 416;
+    uint16_t gyroBandWidth      = 400;
+    uint8_t  gyroFifoEnabled    = 1;
+    uint8_t  gyroFifoDecimation = 1;
+    uint8_t  accelEnabled       = 1;
+    uint8_t  accelODROff        = 1;
+    uint16_t accelRange         = 16;
+    uint16_t accelSampleRate    = 416;
+    uint16_t accelBandWidth     = 100;
+    uint8_t  accelFifoEnabled   = 1;
+    uint8_t  accelFifoDecimation= 1;
+    uint8_t  tempEnabled        = 1;
+    uint8_t  commMode           = 1;
+    uint16_t fifoThreshold      = 3000;
+    int16_t  fifoSampleRate     = 10;
+    uint8_t  fifoModeWord       = 0;
+};
+
+class LSM6DS3 {
+public:
+    SensorSettings settings;
+
+    LSM6DS3(uint8_t busType = I2C_MODE, uint8_t inputArg = 0x6A) {}
+
+    status_t begin() { return IMU_SUCCESS; }
+
+    // ---------------- Recording control (mock only) ----------------
+
+    // Loads a CSV recording; returns the number of frames read
+    size_t load_csv(const char *path)
+    {
+        frames_.clear();
+        std::ifstream in(path);
+        std::string line;
+        std::getline(in, line);  // header
+        while (std::getline(in, line)) {
+            std::stringstream row(line);
+            std::string cell;
+            float v[6];
+            int n = 0;
+            while (n < 6 && std::getline(row, cell, ',')) {
+                v[n++] = std::stof(cell);
+            }
+            if (n == 6) {
+                Frame f;
+                for (int i = 0; i < 3; i++) f.g[i] = rawGyro(v[3 + i]);
+                for (int i = 0; i < 3; i++) f.a[i] = rawAccel(v[i]);
+                frames_.push_back(f);
+            }
+        }
+        cursor_ = 0;
+        return frames_.size();
+    }
+
+    // When false (default) frames only appear at the programmed ODR against
+    // host_clock; when true every status read tops the FIFO up to
+    // 'burst' frames, which is what benchmarks want.
+    void set_free_running(bool on, uint16_t burst = 64) { free_running_ = on; burst_ = burst; }
+
+    // Pushes n recorded frames into the FIFO right now
+    void push_frames(size_t n)
+    {
+        for (size_t i = 0; i < n && !frames_.empty(); i++) {
+            const Frame &f = frames_[cursor_];
+            cursor_ = (cursor_ + 1) % frames_.size();
+            for (int k = 0; k < 3; k++) pushWord(f.g[k]);
+            for (int k = 0; k < 3; k++) pushWord(f.a[k]);
+        }
+    }
+
+    // Next push_frames() starts from the first recorded frame again
+    void rewind() { cursor_ = 0; }
+
+    size_t fifo_words() const { return fifo_.size(); }
+
+    // ---------------- Library API ----------------
+
+    float readFloatAccelX() { return calcAccel(current().a[0]); }
+    float readFloatAccelY() { return calcAccel(current().a[1]); }
+    float readFloatAccelZ() { return calcAccel(current().a[2]); }
+    float readFloatGyroX()  { return calcGyro(current().g[0]); }
+    float readFloatGyroY()  { return calcGyro(current().g[1]); }
+    float readFloatGyroZ()  { return calcGyro(current().g[2]); }
+
+    float calcAccel(int16_t input)
+    {
+        return (float)input * 0.061f * (settings.accelRange >> 1) / 1000.0f;
+    }
+
+    float calcGyro(int16_t input)
+    {
+        uint8_t divisor = settings.gyroRange / 125;
+        if (settings.gyroRange == 245) divisor = 2;
+        return (float)input * 4.375f * divisor / 1000.0f;
+    }
+
+    status_t writeRegister(uint8_t offset, uint8_t data)
+    {
+        regs_[offset] = data;
+        if (offset == 0x0A) {  // FIFO_CTRL5
+            fifo_.clear();
+            pattern_ = 0;
+            overrun_ = false;
+            enabled_at_ = Clock::now();
+            emitted_ = 0;
+        }
+        return IMU_SUCCESS;
+    }
+
+    status_t readRegister(uint8_t *out, uint8_t offset)
+    {
+        return readRegisterRegion(out, offset, 1);
+    }
+
+    status_t readRegisterRegion(uint8_t *out, uint8_t offset, uint8_t length)
+    {
+        for (uint8_t i = 0; i < length; i++) {
+            if (offset == 0x3E || offset == 0x3F) {
+                // DATA_OUT_L/H: consume whole words, address wraps back to L
+                int16_t w = popWord();
+                out[i] = (uint8_t)(w & 0xFF);
+                if (i + 1 < length) out[++i] = (uint8_t)((w >> 8) & 0xFF);
+            } else {
+                out[i] = readOne((uint8_t)(offset + i));
+            }
+        }
+        return IMU_SUCCESS;
+    }
+
+private:
+    typedef host_clock Clock;
+
+    struct Frame { int16_t a[3]; int16_t g[3]; };
+
+    static const size_t FIFO_DEPTH_WORDS = 4096;
+
+    std::vector<Frame>  frames_;
+    size_t              cursor_       = 0;
+    std::deque<int16_t> fifo_;
+    uint16_t            pattern_      = 0;
+    bool                overrun_      = false;
+    bool                free_running_ = false;
+    uint16_t            burst_        = 64;
+    uint8_t             regs_[128]    = {0};
+    Clock::time_point   enabled_at_   = Clock::now();
+    uint64_t            emitted_      = 0;
+
+    int16_t rawAccel(float g)   { return clamp16(g * 1000.0f / (0.061f * (settings.accelRange >> 1))); }
+    int16_t rawGyro(float dps)
+    {
+        uint8_t divisor = settings.gyroRange / 125;
+        if (settings.gyroRange == 245) divisor = 2;
+        return clamp16(dps * 1000.0f / (4.375f * divisor));
+    }
+    static int16_t clamp16(float v)
+    {
+        v = std::round(v);
+        if (v >  32767.0f) v =  32767.0f;
+        if (v < -32768.0f) v = -32768.0f;
+        return (int16_t)v;
+    }
+
+    Frame current() const
+    {
+        if (frames_.empty()) return Frame{{0, 0, 0}, {0, 0, 0}};
+        return frames_[(cursor_ + frames_.size() - 1) % frames_.size()];
+    }
+
+    bool fifoEnabled() const { return (regs_[0x0A] & 0x07) != 0; }
+
+    void pushWord(int16_t w)
+    {
+        if (fifo_.size() >= FIFO_DEPTH_WORDS) {
+            fifo_.pop_front();
+            overrun_ = true;
+        }
+        fifo_.push_back(w);
+    }
+
+    int16_t popWord()
+    {
+        if (fifo_.empty()) return 0;
+        int16_t w = fifo_.front();
+        fifo_.pop_front();
+        pattern_ = (pattern_ + 1) % 6;
+        return w;
+    }
+
+    void refill()
+    {
+        if (!fifoEnabled()) return;
+        if (free_running_) {
+            size_t frames = fifo_.size() / 6;
+            if (frames < burst_) push_frames(burst_ - frames);
+            return;
+        }
+        // ODR_FIFO = 104 Hz * 2^(bits - 4) for the 12.5 Hz .. 6.66 kHz range
+        uint8_t bits = (regs_[0x0A] >> 3) & 0x0F;
+        double  odr  = 13.0 * std::pow(2.0, (double)bits - 1.0);
+        double  secs = std::chrono::duration<double>(Clock::now() - enabled_at_).count();
+        uint64_t due = (uint64_t)(secs * odr);
+        if (due > emitted_) {
+            push_frames((size_t)(due - emitted_));
+            emitted_ = due;
+        }
+    }
+
+    uint8_t readOne(uint8_t reg)
+    {
+        switch (reg) {
+        case 0x3A:  // FIFO_STATUS1
+            refill();
+            return (uint8_t)(fifo_.size() & 0xFF);
+        case 0x3B: {  // FIFO_STATUS2
+            uint8_t v = (uint8_t)((fifo_.size() >> 8) & 0x0F);
+            if (fifo_.empty()) v |= 0x10;
+            if (overrun_)      v |= 0x40;
+            overrun_ = false;
+            return v;
+        }
+        case 0x3C:  // FIFO_STATUS3
+            return (uint8_t)(pattern_ & 0xFF);
+        case 0x3D:  // FIFO_STATUS4
+            return (uint8_t)((pattern_ >> 8) & 0x03);
+        default:
+            return regs_[reg & 0x7F];
+        }
+    }
+};
+
+#endif // HOST_LSM6DS3_H
@@ -0,0 +1,14 @@
+// Host-side stand-in for the Arduino SPI library; the display bus is
+// simulated in lv_xiao_host_bus.cpp instead.
+#ifndef HOST_SPI_H
+#define HOST_SPI_H
+
+class SPIClass {
+public:
+    void begin() {}
+    void end() {}
+};
+
+extern SPIClass SPI;
+
+#endif // HOST_SPI_H
@@ -0,0 +1,6 @@
+// The Arduino TFLM library's umbrella header. A host build against a TFLM
+// source tree (TFLM_DIR) gets the real headers from their own paths, so
+// there is nothing to pull in here.
+#ifndef HOST_TENSORFLOWLITE_H
+#define HOST_TENSORFLOWLITE_H
+#endif // HOST_TENSORFLOWLITE_H
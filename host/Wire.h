@@ -0,0 +1,26 @@
+// Host-side stand-in for the Arduino Wire library.
+//
+// Nothing on the host talks I2C: the IMU and touch fakes are driven through
+// their library interfaces, so every transfer here just reports no device.
+#ifndef HOST_WIRE_H
+#define HOST_WIRE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+class TwoWire {
+public:
+    void    begin() {}
+    void    setClock(uint32_t hz) { (void)hz; }
+    void    beginTransmission(uint8_t addr) { (void)addr; }
+    uint8_t endTransmission(bool stop = true) { (void)stop; return 2; }  // NACK on address
+    size_t  write(uint8_t data) { (void)data; return 1; }
+    uint8_t requestFrom(uint8_t addr, uint8_t len) { (void)addr; (void)len; return 0; }
+    int     available() { return 0; }
+    int     read() { return -1; }
+    size_t  readBytes(uint8_t *buf, size_t len) { (void)buf; (void)len; return 0; }
+};
+
+extern TwoWire Wire;
+
+#endif // HOST_WIRE_H
@@ -0,0 +1,42 @@
+// Globals and out-of-line parts of the host Arduino shim (Arduino.h, Wire.h,
+// SPI.h).
+#include <Arduino.h>
+#include <SPI.h>
+#include <Wire.h>
+
+#include <thread>
+
+HostSerial Serial;
+TwoWire    Wire;
+SPIClass   SPI;
+
+// Set by a host run that wants wall-clock pacing, e.g. to watch it live
+bool host_realtime = false;
+
+void (*host_delay_hook)(void) = NULL;
+
+void delay(unsigned long ms)
+{
+    if (host_realtime) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    } else {
+        host_clock::advance(std::chrono::milliseconds(ms));
+    }
+    if (host_delay_hook) {
+        host_delay_hook();
+    }
+}
+
+void delayMicroseconds(unsigned int us)
+{
+    if (host_realtime) {
+        std::this_thread::sleep_for(std::chrono::microseconds(us));
+    } else {
+        host_clock::advance(std::chrono::microseconds(us));
+    }
+}
+
+extern "C" uint32_t host_millis(void)
+{
+    return (uint32_t)millis();
+}
@@ -0,0 +1,171 @@
+// Host-side stand-in for the CHSC6X touch controller.
+//
+// Replays touch traces in the format touch_events_trace() prints
+// (t_ms,down,x,y with a header row) against a clock the host run owns.
+// While a finger is down the fake raises a report every CHSC6X_FAKE_REPORT_MS
+// by calling touch_events_isr(), holds INT low and answers reads with the
+// point at that time, so touch_events.cpp runs unmodified off-target.
+// follow() moves the replay along with every delay() the sketch makes, so
+// reports land inside a loop() pass, not only between passes.
+//
+// Define CHSC6X_FAKE_IMPLEMENTATION in exactly one host file to get the
+// chsc6x_read_point() / chsc6x_int_active() glue the library normally provides.
+#ifndef HOST_CHSC6X_FAKE_H
+#define HOST_CHSC6X_FAKE_H
+
+#include <stdint.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lv_xiao_round_screen.h"
+#include "touch_events.h"
+
+#define CHSC6X_FAKE_REPORT_MS 10   // report rate of the real part, ~100 Hz
+
+class Chsc6xFake {
+public:
+    struct Sample {
+        uint32_t ms;
+        bool     down;
+        int16_t  x, y;
+    };
+
+    // Loads a trace; returns the number of samples read
+    size_t load_csv(const char *path)
+    {
+        samples_.clear();
+        std::ifstream in(path);
+        std::string line;
+        std::getline(in, line);  // header
+        while (std::getline(in, line)) {
+            std::stringstream row(line);
+            std::string cell;
+            long v[4];
+            int n = 0;
+            while (n < 4 && std::getline(row, cell, ',')) {
+                v[n++] = std::stol(cell);
+            }
+            if (n == 4) {
+                samples_.push_back({(uint32_t)v[0], v[1] != 0, (int16_t)v[2], (int16_t)v[3]});
+            }
+        }
+        rewind();
+        return samples_.size();
+    }
+
+    void clear()
+    {
+        samples_.clear();
+        rewind();
+    }
+
+    void add(uint32_t ms, bool down, int16_t x, int16_t y)
+    {
+        samples_.push_back({ms, down, x, y});
+    }
+
+    void rewind()
+    {
+        now_ms_ = 0;
+        next_report_ms_ = 0;
+        was_down_ = false;
+        reads_ = 0;
+    }
+
+    // Current time of the replay; a host millis() should return this
+    uint32_t now() const { return now_ms_; }
+
+    // From now on every delay() runs the replay up to millis() - origin_ms
+    void follow(uint32_t origin_ms)
+    {
+        origin_ms_ = origin_ms;
+        host_delay_hook = on_delay;
+    }
+
+    // Moves the clock to t_ms, raising every report the controller would
+    // have sent on the way (including the final "lifted" one)
+    void run_until(uint32_t t_ms)
+    {
+        while (next_report_ms_ <= t_ms) {
+            now_ms_ = next_report_ms_;
+            bool down = current().down;
+            if (down || was_down_) {
+                touch_events_isr();
+            }
+            was_down_ = down;
+            next_report_ms_ += CHSC6X_FAKE_REPORT_MS;
+        }
+        now_ms_ = t_ms;
+    }
+
+    uint32_t duration() const { return samples_.empty() ? 0 : samples_.back().ms; }
+    uint32_t reads() const { return reads_; }
+
+    // ---------------- Controller side ----------------
+
+    bool int_active() const { return current().down; }
+
+    bool read(lv_coord_t *x, lv_coord_t *y, bool *touched)
+    {
+        reads_++;
+        const Sample &s = current();
+        *touched = s.down;
+        if (s.down) {
+            *x = s.x;
+            *y = s.y;
+        }
+        return true;
+    }
+
+private:
+    // Last sample at or before now; the trace holds its value until the next one
+    const Sample &current() const
+    {
+        static const Sample idle = {0, false, 0, 0};
+        const Sample *found = &idle;
+        for (const Sample &s : samples_) {
+            if (s.ms > now_ms_) {
+                break;
+            }
+            found = &s;
+        }
+        return *found;
+    }
+
+    static void on_delay();
+
+    std::vector<Sample> samples_;
+    uint32_t origin_ms_ = 0;
+    uint32_t now_ms_ = 0;
+    uint32_t next_report_ms_ = 0;
+    bool     was_down_ = false;
+    uint32_t reads_ = 0;
+};
+
+extern Chsc6xFake chsc6x_fake;
+
+#ifdef CHSC6X_FAKE_IMPLEMENTATION
+Chsc6xFake chsc6x_fake;
+
+void Chsc6xFake::on_delay()
+{
+    uint32_t t = millis() - chsc6x_fake.origin_ms_;
+    if (t > chsc6x_fake.now_ms_) {
+        chsc6x_fake.run_until(t);
+    }
+}
+
+bool chsc6x_read_point(lv_coord_t *x, lv_coord_t *y, bool *touched)
+{
+    return chsc6x_fake.read(x, y, touched);
+}
+
+bool chsc6x_int_active(void)
+{
+    return chsc6x_fake.int_active();
+}
+#endif
+
+#endif // HOST_CHSC6X_FAKE_H
@@ -0,0 +1,44 @@
+// Stands in for gesture_engine.cpp in host builds without TFLM (no TFLM_DIR).
+//
+// Same API, but the engine never comes up: gesture_engine_init() returns
+// false, exactly like a board whose model failed to load, so captures and
+// the stream run their sampling paths and report a failed classification.
+#include "gesture_engine.h"
+
+static const char *GESTURES[GESTURE_NUM_CLASSES] = {"bow", "sleep", "circle"};
+
+bool gesture_engine_init(void)
+{
+    return false;
+}
+
+bool gesture_engine_ready(void)
+{
+    return false;
+}
+
+float gesture_engine_input_scale(void)
+{
+    return 1.0f;
+}
+
+int gesture_engine_input_zero_point(void)
+{
+    return 0;
+}
+
+bool gesture_engine_classify(const int8_t *window, gesture_result_t *result)
+{
+    (void)window;
+    result->label      = -1;
+    result->latency_us = 0;
+    return false;
+}
+
+const char *gesture_engine_label(int index)
+{
+    if (index < 0 || index >= GESTURE_NUM_CLASSES) {
+        return "none";
+    }
+    return GESTURES[index];
+}
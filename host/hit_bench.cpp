@@ -0,0 +1,127 @@
+// The hit-region grid index (hit_regions.cpp) against a linear scan over
+// every region, at 4, 32 and 256 regions.
+//
+//   hit_bench [--lookups N]
+//
+//   --lookups N  random touch points resolved per registry size (default 5000)
+//
+// Registries are filled with button-sized rectangles and circles from a
+// fixed random sequence, so numbers compare between builds. Prints the
+// index build time, us per lookup both ways and the average regions listed
+// in the touched cell. Exits 1 if the two lookups ever disagree.
+#include <Arduino.h>
+
+#include "hit_regions.h"
+#include "touch_events.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+// hit_dispatch() reads this pass's touch events; nothing presses here
+uint8_t touch_frame_events(const touch_event_t **events)
+{
+    *events = NULL;
+    return 0;
+}
+
+static const uint16_t BENCH_REGIONS[] = {4, 32, 256};
+
+// Same sequence on every run
+static uint32_t rng_state;
+
+static uint16_t rng(uint16_t range)
+{
+    rng_state = rng_state * 1664525UL + 1013904223UL;
+    return (rng_state >> 16) % range;
+}
+
+// Button-sized targets, roughly what a screen of items would register
+static void fill_registry(hit_registry_t *reg, uint16_t count)
+{
+    hit_registry_clear(reg);
+    for (uint16_t i = 0; i < count; i++) {
+        if (i & 1) {
+            hit_add_circle(reg, rng(SCREEN_WIDTH), rng(SCREEN_HEIGHT), 6 + rng(20));
+        } else {
+            int x = rng(SCREEN_WIDTH - 12);
+            int y = rng(SCREEN_HEIGHT - 12);
+            hit_add_rect(reg, x, x + 12 + rng(40), y, y + 12 + rng(40));
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t lookups = 5000;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--lookups") && i + 1 < argc) {
+            lookups = strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--lookups N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (lookups == 0) {
+        lookups = 1;
+    }
+
+    hit_registry_t reg;
+    if (!hit_registry_init(&reg, BENCH_REGIONS[sizeof(BENCH_REGIONS) / sizeof(BENCH_REGIONS[0]) - 1])) {
+        fprintf(stderr, "hit_bench: no memory\n");
+        return 1;
+    }
+    std::vector<lv_point_t> points(lookups);
+
+    printf("%8s %9s %15s %17s %18s %10s\n", "regions", "build_us", "grid_us/lookup",
+           "linear_us/lookup", "candidates/lookup", "mismatches");
+
+    uint32_t failed = 0;
+    for (uint16_t count : BENCH_REGIONS) {
+        rng_state = 12345;
+        fill_registry(&reg, count);
+        for (lv_point_t &p : points) {
+            p.x = rng(SCREEN_WIDTH);
+            p.y = rng(SCREEN_HEIGHT);
+        }
+
+        // First lookup builds the index
+        uint32_t start = micros();
+        hit_find(&reg, 0, 0);
+        uint32_t build_us = micros() - start;
+
+        // The id sums are compared below, so neither loop can be dropped
+        int32_t grid_sum = 0;
+        start = micros();
+        for (const lv_point_t &p : points) {
+            grid_sum += hit_find(&reg, p.x, p.y);
+        }
+        uint32_t grid_us = micros() - start;
+
+        int32_t linear_sum = 0;
+        start = micros();
+        for (const lv_point_t &p : points) {
+            linear_sum += hit_find_linear(&reg, p.x, p.y);
+        }
+        uint32_t linear_us = micros() - start;
+
+        // Untimed: regions listed in the cell and agreement with the linear scan
+        uint32_t candidates = 0;
+        uint32_t mismatches = grid_sum != linear_sum;
+        for (const lv_point_t &p : points) {
+            uint16_t cell = (p.y / HIT_GRID_CELL) * HIT_GRID_COLS + p.x / HIT_GRID_CELL;
+            candidates += reg.cell_start[cell + 1] - reg.cell_start[cell];
+            mismatches += hit_find(&reg, p.x, p.y) != hit_find_linear(&reg, p.x, p.y);
+        }
+        failed += mismatches;
+
+        printf("%8u %9lu %15.3f %17.3f %18.2f %10lu\n", reg.count, (unsigned long)build_us,
+               (double)grid_us / lookups, (double)linear_us / lookups,
+               (double)candidates / lookups, (unsigned long)mismatches);
+    }
+
+    hit_registry_free(&reg);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,74 @@
+// Time base shared by every host-side stand-in.
+//
+// Real steady_clock time plus whatever delay() skipped. A host run goes at
+// full speed: delay(16) in loop() costs nothing, yet millis(), the IMU's
+// sample rate and the display bus all see the 16 ms go by, so the sketch
+// behaves as it would on the board, only faster. Code that really spends
+// time (rendering, inference) is still measured in real time.
+#ifndef HOST_CLOCK_H
+#define HOST_CLOCK_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+#include <chrono>
+
+struct host_clock {
+    typedef std::chrono::nanoseconds          duration;
+    typedef duration::rep                     rep;
+    typedef duration::period                  period;
+    typedef std::chrono::time_point<host_clock> time_point;
+    static const bool is_steady = true;
+
+    static time_point now()
+    {
+        return time_point(real() + skipped());
+    }
+
+    // Moves the clock forward without waiting; what delay() does on the host
+    static void advance(duration d) { skipped() += d; }
+
+    // Stepped: real time is left out, so only delay() and the simulated bus
+    // move the clock and a run renders the same frames every time
+    static void set_stepped(bool on)
+    {
+        duration at = now().time_since_epoch();
+        stepped_flag() = on;
+        skipped() = at - real();   // no jump either way
+    }
+    static bool stepped() { return stepped_flag(); }
+
+private:
+    static std::chrono::steady_clock::time_point origin()
+    {
+        static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        return start;
+    }
+    static duration real()
+    {
+        return stepped_flag() ? duration(0)
+                              : std::chrono::duration_cast<duration>(std::chrono::steady_clock::now() - origin());
+    }
+    static bool &stepped_flag()
+    {
+        static bool on = false;
+        return on;
+    }
+    static duration &skipped()
+    {
+        static duration total(0);
+        return total;
+    }
+};
+
+extern "C" {
+#endif
+
+// Milliseconds on host_clock, for LVGL's LV_TICK_CUSTOM (C code)
+uint32_t host_millis(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HOST_CLOCK_H
@@ -0,0 +1,204 @@
+// Replays IMU recordings through the FIFO reader and checks that what comes
+// out of the ring is the recording, frame for frame.
+//
+//   imu_fifo_check rec.csv [rec.csv ...]
+//
+// Recordings are the notebook's aX,aY,aZ,gX,gY,gZ CSVs (punch.csv, ...).
+// Each one goes through three cases against the LSM6DS3 fake, with the FIFO
+// filled by hand rather than at the ODR:
+//
+//   aligned   a few bursts' worth of frames, drained and popped in order
+//   pattern   1..5 words already read when the drain starts, so it has to
+//             skip the rest of that frame and carry on from the next one
+//   overflow  two full drains without a pop: the ring keeps the newest
+//             IMU_RING_FRAMES and counts the oldest as dropped
+//
+// A frame matches if every axis decodes to within half a count of the CSV.
+// Exits 1 on any mismatch.
+#include <Arduino.h>
+#include <LSM6DS3.h>
+
+#include "imu_fifo.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct row_t {
+    float v[6];   // aX aY aZ gX gY gZ
+};
+
+static std::vector<row_t> load_rows(const char *path)
+{
+    std::vector<row_t> rows;
+    std::ifstream in(path);
+    std::string line;
+    std::getline(in, line);  // header
+    while (std::getline(in, line)) {
+        std::stringstream cells(line);
+        std::string cell;
+        row_t row;
+        int n = 0;
+        while (n < 6 && std::getline(cells, cell, ',')) {
+            row.v[n++] = std::stof(cell);
+        }
+        if (n == 6) {
+            rows.push_back(row);
+        }
+    }
+    return rows;
+}
+
+//----------------------- Checks ------------------------
+
+struct replay_t {
+    const char              *name;
+    LSM6DS3                 *imu;
+    const std::vector<row_t> *rows;
+    uint32_t                 failures;
+};
+
+// One count in g or deg/s for an axis
+static float axis_count(LSM6DS3 *imu, int axis)
+{
+    return axis < 3 ? imu->calcAccel(1) : imu->calcGyro(1);
+}
+
+static bool same_frame(replay_t *r, const imu_frame_t *frame, size_t index)
+{
+    float decoded[6];
+    imu_frame_to_float(frame, decoded);
+
+    const row_t &row = (*r->rows)[index % r->rows->size()];
+    for (int axis = 0; axis < 6; axis++) {
+        // Past full scale the sensor saturates, and so does the fake. The
+        // slack over half a count covers float rounding near 2000 deg/s.
+        float count  = axis_count(r->imu, axis);
+        float expect = constrain(row.v[axis], count * INT16_MIN, count * INT16_MAX);
+        if (fabsf(decoded[axis] - expect) > count * 0.51f) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Pops everything and compares it against recording rows first, first + 1, ...
+static void expect_ring(replay_t *r, const char *what, size_t first, uint16_t expected_count)
+{
+    uint16_t count = imu_ring_count();
+    if (count != expected_count) {
+        printf("%s %s: ring holds %u frames, expected %u\n", r->name, what, count, expected_count);
+        r->failures++;
+    }
+
+    imu_frame_t frame;
+    for (size_t i = 0; imu_ring_pop(&frame); i++) {
+        if (!same_frame(r, &frame, first + i)) {
+            printf("%s %s: frame %zu isn't recording row %zu\n", r->name, what, i,
+                   (first + i) % r->rows->size());
+            r->failures++;
+            imu_ring_clear();
+            return;
+        }
+    }
+}
+
+static void check_aligned(replay_t *r)
+{
+    imu_fifo_begin(r->imu);
+    r->imu->rewind();
+    r->imu->push_frames(3 * IMU_FIFO_BURST_FRAMES + 1);
+
+    uint16_t drained = imu_fifo_drain();
+    if (drained != 3 * IMU_FIFO_BURST_FRAMES + 1 || imu_fifo_stats()->bursts != 4) {
+        printf("%s aligned: drained %u frames in %lu bursts\n", r->name, drained,
+               (unsigned long)imu_fifo_stats()->bursts);
+        r->failures++;
+    }
+    expect_ring(r, "aligned", 0, drained);
+}
+
+static void check_pattern(replay_t *r)
+{
+    for (uint8_t words = 1; words < IMU_FIFO_WORDS_PER_FRAME; words++) {
+        imu_fifo_begin(r->imu);
+        r->imu->rewind();
+        r->imu->push_frames(8);
+
+        // Someone read part of frame 0 before the drain got there
+        uint8_t partial[IMU_FIFO_WORDS_PER_FRAME * 2];
+        r->imu->readRegisterRegion(partial, IMU_REG_FIFO_DATA_OUT_L, words * 2);
+
+        char what[32];
+        snprintf(what, sizeof(what), "pattern %u", words);
+        if (imu_fifo_drain() != 7) {
+            printf("%s %s: didn't realign on the next frame\n", r->name, what);
+            r->failures++;
+        }
+
+        // More frames behind the realigned ones have to follow on seamlessly
+        r->imu->push_frames(3);
+        imu_fifo_drain();
+        expect_ring(r, what, 1, 10);
+    }
+}
+
+static void check_overflow(replay_t *r)
+{
+    const uint16_t extra = 40;
+
+    imu_fifo_begin(r->imu);
+    r->imu->rewind();
+    r->imu->push_frames(IMU_RING_FRAMES + extra);
+
+    // The first drain stops at a full ring, the second pushes the oldest out
+    uint16_t first  = imu_fifo_drain();
+    uint16_t second = imu_fifo_drain();
+    const imu_fifo_stats_t *stats = imu_fifo_stats();
+    if (first != IMU_RING_FRAMES || second != extra || stats->dropped != extra) {
+        printf("%s overflow: drained %u + %u, dropped %lu\n", r->name, first, second,
+               (unsigned long)stats->dropped);
+        r->failures++;
+    }
+    expect_ring(r, "overflow", extra, IMU_RING_FRAMES);
+}
+
+//----------------------- Main ------------------------
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s rec.csv [rec.csv ...]\n", argv[0]);
+        return 2;
+    }
+
+    // Only the frames pushed here reach the FIFO, none from the ODR
+    host_clock::set_stepped(true);
+
+    uint32_t failures = 0;
+    for (int i = 1; i < argc; i++) {
+        std::vector<row_t> rows = load_rows(argv[i]);
+        LSM6DS3 imu;
+        imu.begin();
+        if (rows.empty() || imu.load_csv(argv[i]) != rows.size()) {
+            printf("%s: no frames\n", argv[i]);
+            failures++;
+            continue;
+        }
+
+        replay_t r = {argv[i], &imu, &rows, 0};
+        check_aligned(&r);
+        check_pattern(&r);
+        check_overflow(&r);
+        imu_fifo_end();
+
+        printf("%s: %zu frames, %s\n", argv[i], rows.size(),
+               r.failures ? "FAILED" : "aligned, pattern 1..5 and overflow ok");
+        failures += r.failures;
+    }
+    return failures ? 1 : 0;
+}
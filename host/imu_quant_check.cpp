@@ -0,0 +1,169 @@
+// Checks the integer quantisation kernel against the float path it replaced,
+// on recorded data and on every possible raw count, and times both.
+//
+//   imu_quant_check [--scale S --zero Z] [--frames N] rec.csv [rec.csv ...]
+//
+//   --scale S, --zero Z  the model's input scale and zero point; without them
+//                        a few representative pairs are checked, starting
+//                        with what a [0, 1] input calibrates to (1/255, -128)
+//   --frames N           frames per path for the timing (default 200000)
+//
+// Recordings are the notebook's aX,aY,aZ,gX,gY,gZ CSVs. They go through the
+// LSM6DS3 fake and the FIFO reader, so both paths see the same raw counts
+// they would on the board. Exits 1 if the paths disagree anywhere.
+#include <Arduino.h>
+#include <LSM6DS3.h>
+
+#include "gesture_engine.h"
+#include "imu_fifo.h"
+#include "imu_quant.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+struct quant_params_t {
+    float scale;
+    int   zero_point;
+};
+
+// The second pair is deliberately uneven, so more values land near a tie
+static const quant_params_t DEFAULT_PARAMS[] = {
+    {1.0f / 255, -128},
+    {0.0041f,    -122},
+};
+
+// The float reference path reads these; here they are whatever is under test
+static quant_params_t current;
+
+float gesture_engine_input_scale(void)
+{
+    return current.scale;
+}
+
+int gesture_engine_input_zero_point(void)
+{
+    return current.zero_point;
+}
+
+// Every frame of a recording, as the FIFO reader hands them out
+static std::vector<imu_frame_t> load_frames(LSM6DS3 *imu, const char *path)
+{
+    std::vector<imu_frame_t> frames;
+    size_t count = imu->load_csv(path);
+
+    imu_fifo_begin(imu);
+    while (frames.size() < count) {
+        imu->push_frames(count - frames.size() < IMU_RING_FRAMES ? count - frames.size()
+                                                                 : IMU_RING_FRAMES);
+        imu_fifo_drain();
+        imu_frame_t frame;
+        while (imu_ring_pop(&frame)) {
+            frames.push_back(frame);
+        }
+    }
+    imu_fifo_end();
+    return frames;
+}
+
+static uint32_t mismatched_frames(const std::vector<imu_frame_t> &frames)
+{
+    uint32_t mismatches = 0;
+    for (const imu_frame_t &frame : frames) {
+        int8_t fixed[GESTURE_NUM_AXES], reference[GESTURE_NUM_AXES];
+        imu_quant_frame(&frame, fixed);
+        imu_quant_frame_reference(&frame, reference);
+        mismatches += memcmp(fixed, reference, sizeof(fixed)) != 0;
+    }
+    return mismatches;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--scale S --zero Z] [--frames N] rec.csv [rec.csv ...]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<quant_params_t> params(DEFAULT_PARAMS, DEFAULT_PARAMS + sizeof(DEFAULT_PARAMS) / sizeof(DEFAULT_PARAMS[0]));
+    quant_params_t given = {0.0f, 0};
+    bool           has_scale = false, has_zero = false;
+    uint32_t       bench_frames = 200000;
+    std::vector<const char *> paths;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--scale") && i + 1 < argc) {
+            given.scale = strtof(argv[++i], NULL);
+            has_scale = true;
+        } else if (!strcmp(argv[i], "--zero") && i + 1 < argc) {
+            given.zero_point = atoi(argv[++i]);
+            has_zero = true;
+        } else if (!strcmp(argv[i], "--frames") && i + 1 < argc) {
+            bench_frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 2;
+        } else {
+            paths.push_back(argv[i]);
+        }
+    }
+    if (paths.empty() || has_scale != has_zero || (has_scale && given.scale <= 0.0f)) {
+        usage(argv[0]);
+        return 2;
+    }
+    if (has_scale) {
+        params.assign(1, given);
+    }
+    if (bench_frames == 0) {
+        bench_frames = 1;
+    }
+
+    // Only the frames pushed here reach the FIFO, none from the ODR
+    host_clock::set_stepped(true);
+
+    LSM6DS3 imu;
+    imu.begin();
+
+    std::vector<std::vector<imu_frame_t>> recordings;
+    for (const char *path : paths) {
+        recordings.push_back(load_frames(&imu, path));
+        if (recordings.back().empty()) {
+            printf("%s: no frames\n", path);
+            return 1;
+        }
+    }
+
+    // imu_frame_to_float() inside the reference path needs the reader set up;
+    // the timing wants the real clock back
+    imu_fifo_begin(&imu);
+    host_clock::set_stepped(false);
+
+    bool ok = true;
+    for (const quant_params_t &p : params) {
+        current = p;
+        imu_quant_init(&imu);
+        printf("scale %.7f zero point %d\n", p.scale, p.zero_point);
+
+        uint32_t sweep = imu_quant_verify();
+        printf("  every raw count: %lu mismatches\n", (unsigned long)sweep);
+        ok &= sweep == 0;
+
+        for (size_t i = 0; i < paths.size(); i++) {
+            const std::vector<imu_frame_t> &frames = recordings[i];
+            uint32_t mismatches = mismatched_frames(frames);
+            printf("  %s: %zu frames, %lu mismatched\n", paths[i], frames.size(),
+                   (unsigned long)mismatches);
+            ok &= mismatches == 0;
+
+            uint16_t count = frames.size() > UINT16_MAX ? UINT16_MAX : (uint16_t)frames.size();
+            printf("  ");
+            fflush(stdout);
+            imu_quant_benchmark(frames.data(), count, bench_frames);
+        }
+    }
+
+    imu_fifo_end();
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,71 @@
+// Turns a binary log dump (LOG_MODE_BINARY) back into the lines text mode prints.
+//
+//   g++ -I.. -o log_decode log_decode.cpp
+//   ./log_decode capture.bin        (or read from stdin)
+//
+// Anything that isn't a well-formed record, e.g. plain Serial.print output
+// captured along with the dump, is skipped up to the next sync byte.
+#include "log_events.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+
+#define LOG_EVENT_FMT(id, fmt) fmt,
+static const char *const event_fmt[] = {
+    LOG_EVENTS(LOG_EVENT_FMT)
+};
+#undef LOG_EVENT_FMT
+
+static const char level_tag[] = {'E', 'W', 'I', 'D'};
+
+static int32_t get_i32(const uint8_t *src)
+{
+    return (int32_t)((uint32_t)src[0] | ((uint32_t)src[1] << 8) |
+                     ((uint32_t)src[2] << 16) | ((uint32_t)src[3] << 24));
+}
+
+int main(int argc, char **argv)
+{
+    FILE *in = argc > 1 ? fopen(argv[1], "rb") : stdin;
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<uint8_t> data;
+    uint8_t chunk[4096];
+    size_t  n;
+    while ((n = fread(chunk, 1, sizeof(chunk), in)) > 0) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+
+    size_t pos = 0, records = 0, skipped = 0;
+    while (pos + LOG_RECORD_HEADER <= data.size()) {
+        const uint8_t *rec = &data[pos];
+        uint8_t id    = rec[1];
+        uint8_t nargs = rec[2] & 0x03;
+        size_t  len   = LOG_RECORD_HEADER + 4 * nargs;
+
+        if (rec[0] != LOG_RECORD_SYNC || id >= LOG_EV_COUNT || (rec[2] >> 4) != 0 ||
+            pos + len > data.size()) {
+            pos++;
+            skipped++;
+            continue;
+        }
+
+        long a[LOG_RECORD_MAX_ARGS] = {0, 0, 0};
+        for (uint8_t i = 0; i < nargs; i++) {
+            a[i] = get_i32(&rec[LOG_RECORD_HEADER + 4 * i]);
+        }
+        printf("[%lu] %c ", (unsigned long)(uint32_t)get_i32(&rec[3]), level_tag[(rec[2] >> 2) & 0x03]);
+        printf(event_fmt[id], a[0], a[1], a[2]);
+        printf("\n");
+
+        pos += len;
+        records++;
+    }
+
+    fprintf(stderr, "%zu records, %zu bytes skipped\n", records, skipped + (data.size() - pos));
+    return 0;
+}
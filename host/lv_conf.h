@@ -0,0 +1,54 @@
+// LVGL v8 configuration for the host build (found via LV_CONF_INCLUDE_SIMPLE).
+//
+// Only what differs from lv_conf_internal.h's defaults or matters for the
+// comparison with the board: 16-bit colour in the panel's byte order,
+// LVGL's allocations charged to the "lvgl" heap tag, and ticks from
+// host_clock so animations run on the same time base as millis().
+#ifndef LV_CONF_H
+#define LV_CONF_H
+
+#include <stdint.h>
+
+#define LV_COLOR_DEPTH    16
+#define LV_COLOR_16_SWAP  0     // host framebuffer is plain RGB565
+
+// Allocator: heap_stats.cpp's tagged hooks
+#define LV_MEM_CUSTOM          1
+#define LV_MEM_CUSTOM_INCLUDE  <stddef.h>
+#define LV_MEM_CUSTOM_ALLOC    heap_lvgl_malloc
+#define LV_MEM_CUSTOM_FREE     heap_lvgl_free
+#define LV_MEM_CUSTOM_REALLOC  heap_lvgl_realloc
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include <stddef.h>
+void *heap_lvgl_malloc(size_t size);
+void *heap_lvgl_realloc(void *ptr, size_t size);
+void  heap_lvgl_free(void *ptr);
+#ifdef __cplusplus
+}
+#endif
+
+// Time
+#define LV_TICK_CUSTOM                  1
+#define LV_TICK_CUSTOM_INCLUDE          "host_clock.h"
+#define LV_TICK_CUSTOM_SYS_TIME_EXPR    (host_millis())
+
+#define LV_DISP_DEF_REFR_PERIOD  30
+#define LV_INDEV_DEF_READ_PERIOD 30
+
+// Widgets the sketch creates
+#define LV_USE_ARC     1
+#define LV_USE_BAR     1
+#define LV_USE_IMG     1
+#define LV_USE_LABEL   1
+#define LV_USE_CANVAS  1
+
+#define LV_FONT_MONTSERRAT_14 1
+#define LV_FONT_DEFAULT       &lv_font_montserrat_14
+
+#define LV_USE_LOG         0
+#define LV_USE_ASSERT_NULL 1
+
+#endif // LV_CONF_H
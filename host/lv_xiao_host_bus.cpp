@@ -0,0 +1,83 @@
+// Host-side stand-in for the round display's pixel bus.
+//
+// Implements xiao_bus_*() from lv_xiao_round_screen.h so lv_xiao_flush.cpp
+// runs unmodified off-target. A strip "takes" as long as it would on the
+// wire at the configured SPI clock; xiao_bus_done() stays false until that
+// time has passed, and only then are the pixels copied into the host
+// framebuffer. A renderer that writes into a buffer while it is still on
+// the bus therefore shows up as a corrupted frame, just like on hardware.
+#include "lv_xiao_round_screen.h"
+#include "host_clock.h"
+
+#include <string.h>
+
+uint16_t xiao_host_framebuffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+static uint32_t              bus_hz      = SPI_FREQ;
+static bool                  bus_busy    = false;
+static host_clock::time_point busy_until;
+static const xiao_segment_t *pending     = NULL;
+static uint16_t              pending_cnt = 0;
+static uint64_t              busy_ns     = 0;   // simulated wire time so far
+
+// Lets a host run pick a bus speed, e.g. to match a slower board
+void xiao_host_bus_set_hz(uint32_t hz)
+{
+    bus_hz = hz;
+}
+
+// Total simulated time the bus spent sending, for overlap figures
+uint64_t xiao_host_bus_busy_ns(void)
+{
+    return busy_ns;
+}
+
+void xiao_bus_begin(void)
+{
+    bus_busy = false;
+    busy_ns  = 0;
+    memset(xiao_host_framebuffer, 0, sizeof(xiao_host_framebuffer));
+}
+
+void xiao_bus_write_async(const xiao_segment_t *segments, uint16_t count)
+{
+    // Window commands, then 16 bits per pixel, for every rectangle
+    uint64_t bits = 0;
+    for (uint16_t s = 0; s < count; s++) {
+        bits += (XIAO_WINDOW_BYTES + (uint64_t)lv_area_get_size(&segments[s].area) * 2) * 8;
+    }
+    uint64_t ns = bits * 1000000000ULL / bus_hz;
+
+    pending     = segments;
+    pending_cnt = count;
+    busy_until  = host_clock::now() + std::chrono::nanoseconds(ns);
+    busy_ns    += ns;
+    bus_busy    = true;
+}
+
+bool xiao_bus_done(void)
+{
+    if (!bus_busy) {
+        return true;
+    }
+    host_clock::time_point now = host_clock::now();
+    if (now < busy_until) {
+        if (!host_clock::stepped()) {
+            return false;
+        }
+        // Nothing else moves a stepped clock; the caller waits out the wire time
+        host_clock::advance(busy_until - now);
+    }
+
+    for (uint16_t s = 0; s < pending_cnt; s++) {
+        const lv_area_t *area = &pending[s].area;
+        lv_coord_t       w    = area->x2 - area->x1 + 1;
+        for (lv_coord_t y = area->y1; y <= area->y2; y++) {
+            memcpy(&xiao_host_framebuffer[y * SCREEN_WIDTH + area->x1],
+                   &pending[s].px[(y - area->y1) * w], w * sizeof(uint16_t));
+        }
+    }
+
+    bus_busy = false;
+    return true;
+}
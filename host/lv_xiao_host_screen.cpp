@@ -0,0 +1,85 @@
+// Host-side replacement for lv_xiao_round_screen.cpp.
+//
+// Keeps everything above the hardware: the LVGL display is registered by
+// lv_xiao_flush.cpp exactly as on the board, its strips go to the simulated
+// bus in lv_xiao_host_bus.cpp, and touch comes from the chsc6x fake. There is
+// no GC9A01 to bring up and no backlight to turn on.
+#define CHSC6X_FAKE_IMPLEMENTATION
+#include "chsc6x_fake.h"
+
+uint8_t screen_rotation = 0;
+
+//----------------------- Display ------------------------
+
+void xiao_disp_init(void)
+{
+}
+
+void lv_xiao_disp_init(void)
+{
+    xiao_disp_init();
+    xiao_bus_begin();
+
+    // Draw buffers and flush / wait callbacks live in lv_xiao_flush.cpp
+    lv_xiao_disp_register();
+}
+
+//----------------------- Touch ------------------------
+
+bool chsc6x_is_pressed(void)
+{
+    return chsc6x_int_active();
+}
+
+void chsc6x_convert_xy(uint8_t *x, uint8_t *y)
+{
+    // The traces are recorded after rotation already
+    (void)x;
+    (void)y;
+}
+
+void chsc6x_get_xy(lv_coord_t *x, lv_coord_t *y)
+{
+    bool touched;
+    chsc6x_read_point(x, y, &touched);
+}
+
+#if LVGL_VERSION_MAJOR == 9
+void chsc6x_read(lv_indev_t *indev, lv_indev_data_t *data)
+#elif LVGL_VERSION_MAJOR == 8
+void chsc6x_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
+#endif
+{
+    lv_coord_t touchX, touchY;
+    if (!chsc6x_is_pressed()) {
+        data->state = LV_INDEV_STATE_REL;
+    } else {
+        data->state = LV_INDEV_STATE_PR;
+        chsc6x_get_xy(&touchX, &touchY);
+        data->point.x = touchX;
+        data->point.y = touchY;
+    }
+}
+
+static lv_indev_t *touch_indev = NULL;
+
+void lv_xiao_touch_init(void)
+{
+#if LVGL_VERSION_MAJOR == 9
+    lv_indev_t *indev = lv_indev_create();
+    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(indev, chsc6x_read);
+    touch_indev = indev;
+#elif LVGL_VERSION_MAJOR == 8
+    static lv_indev_drv_t indev_drv;
+    lv_indev_drv_init(&indev_drv);
+    indev_drv.type = LV_INDEV_TYPE_POINTER;
+    indev_drv.read_cb = chsc6x_read;
+    touch_indev = lv_indev_drv_register(&indev_drv);
+#endif
+}
+
+lv_indev_t *lv_xiao_touch_indev(void)
+{
+    return touch_indev;
+}
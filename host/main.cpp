@@ -0,0 +1,127 @@
+// Runs the sketch headless: setup(), then loop() for a number of frames,
+// with touch and IMU replayed from recordings and the display landing in
+// xiao_host_framebuffer.
+//
+//   round_display_host [--frames N] [--touch trace.csv] [--imu rec.csv]
+//                      [--imu-burst] [--ppm out.ppm] [--realtime]
+//
+//   --frames N    loop() passes to run (default 600, ~10 s of board time)
+//   --touch FILE  t_ms,down,x,y trace, as touch_events_trace() prints it
+//   --imu FILE    aX,aY,aZ,gX,gY,gZ recording, as the notebook collects it
+//   --imu-burst   FIFO always holds a burst instead of filling at the ODR
+//   --ppm FILE    writes the final frame as a binary PPM
+//   --realtime    delay() sleeps, so the run paces like the board
+//
+// Everything the sketch prints goes to stdout; the summary goes to stderr.
+#include <Arduino.h>
+#include <LSM6DS3.h>
+
+#include "chsc6x_fake.h"
+#include "lv_xiao_round_screen.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+void setup(void);
+void loop(void);
+
+extern LSM6DS3   myIMU;
+extern uint16_t  xiao_host_framebuffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+uint64_t xiao_host_bus_busy_ns(void);
+
+static bool write_ppm(const char *path)
+{
+    FILE *out = fopen(path, "wb");
+    if (!out) {
+        return false;
+    }
+    fprintf(out, "P6\n%d %d\n255\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (int i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        uint16_t c = xiao_host_framebuffer[i];
+        uint8_t rgb[3] = {
+            (uint8_t)(((c >> 11) & 0x1F) * 255 / 31),
+            (uint8_t)(((c >> 5) & 0x3F) * 255 / 63),
+            (uint8_t)((c & 0x1F) * 255 / 31),
+        };
+        fwrite(rgb, 1, sizeof(rgb), out);
+    }
+    return fclose(out) == 0;
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr,
+            "usage: %s [--frames N] [--touch trace.csv] [--imu rec.csv] [--imu-burst]\n"
+            "          [--ppm out.ppm] [--realtime]\n", argv0);
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t    frames    = 600;
+    const char *touch_csv = NULL;
+    const char *imu_csv   = NULL;
+    const char *ppm_path  = NULL;
+    bool        imu_burst = false;
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (!strcmp(argv[i], "--frames") && has_value) {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(argv[i], "--touch") && has_value) {
+            touch_csv = argv[++i];
+        } else if (!strcmp(argv[i], "--imu") && has_value) {
+            imu_csv = argv[++i];
+        } else if (!strcmp(argv[i], "--ppm") && has_value) {
+            ppm_path = argv[++i];
+        } else if (!strcmp(argv[i], "--imu-burst")) {
+            imu_burst = true;
+        } else if (!strcmp(argv[i], "--realtime")) {
+            host_realtime = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+
+    if (touch_csv && chsc6x_fake.load_csv(touch_csv) == 0) {
+        fprintf(stderr, "no touch samples in %s\n", touch_csv);
+        return 1;
+    }
+    if (imu_csv && myIMU.load_csv(imu_csv) == 0) {
+        fprintf(stderr, "no IMU frames in %s\n", imu_csv);
+        return 1;
+    }
+    myIMU.set_free_running(imu_burst);
+
+    setup();
+
+    // Touch trace time 0 is the first loop() pass, like a recording started
+    // once the board is up
+    uint32_t start_ms = millis();
+    std::chrono::steady_clock::time_point wall_start = std::chrono::steady_clock::now();
+    chsc6x_fake.follow(start_ms);
+
+    for (uint32_t f = 0; f < frames; f++) {
+        chsc6x_fake.run_until(millis() - start_ms);
+        loop();
+    }
+    lv_xiao_disp_sync();
+    fflush(stdout);
+
+    double wall_ms = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - wall_start).count();
+    const xiao_flush_stats_t *flush = xiao_flush_stats();
+    fprintf(stderr, "host: %lu frames, %lu ms board time in %.1f ms wall (%.1f frames/s)\n",
+            (unsigned long)frames, (unsigned long)(millis() - start_ms), wall_ms,
+            wall_ms > 0 ? frames * 1000.0 / wall_ms : 0.0);
+    fprintf(stderr, "host: %lu flushes, %.1f ms simulated on the bus, %lu touch reads\n",
+            (unsigned long)flush->flushes, xiao_host_bus_busy_ns() / 1e6,
+            (unsigned long)chsc6x_fake.reads());
+
+    if (ppm_path && !write_ppm(ppm_path)) {
+        fprintf(stderr, "could not write %s\n", ppm_path);
+        return 1;
+    }
+    return 0;
+}
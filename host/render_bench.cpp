@@ -0,0 +1,410 @@
+// Golden-frame regression and render throughput for the host build.
+//
+// Each scene boots the sketch in its own process (LVGL can't be torn down
+// and set up again), replays a scripted touch trace on a stepped clock and
+// hashes the framebuffer after every loop() pass. The hashes are compared
+// with host/golden/<scene>.golden; the first frame that differs is named.
+// At the end of each scene the whole screen is redrawn from scratch and
+// compared with what the partial refreshes left on it, so a missed
+// invalidation or a wrongly claimed cover shows up as stale pixels even
+// without goldens.
+// Throughput comes from the same run: frames per wall-clock second, bytes
+// the flush path sent and the profiler's per-scope time.
+//
+//   render_bench [--scene NAME] [--frames N] [--update] [--golden DIR] [--verbose]
+//
+//   --scene NAME  run one scene (default: all)
+//   --frames N    frames per scene instead of each scene's own count
+//   --update      write the hashes as the new goldens instead of comparing
+//   --golden DIR  golden folder (default: the one next to this file)
+//   --verbose     keep the sketch's Serial output
+//
+// Exits 1 if any scene is missing its golden, differs, has stale pixels or
+// crashes; --update writes no golden for a scene with stale pixels.
+#include <Arduino.h>
+
+#include "animations.h"
+#include "chsc6x_fake.h"
+#include "lv_xiao_round_screen.h"
+#include "profiler.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#ifndef RENDER_GOLDEN_DIR
+#define RENDER_GOLDEN_DIR "golden"
+#endif
+
+#define RENDER_MAX_FRAMES 1024
+
+void setup(void);
+void loop(void);
+
+extern uint16_t xiao_host_framebuffer[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+//----------------------- Scenes ------------------------
+
+typedef struct {
+    uint32_t   ms;        // from the first loop() pass
+    bool       down;
+    lv_coord_t x, y;
+} scene_touch_t;
+
+typedef struct {
+    const char          *name;
+    uint32_t             frames;
+    const scene_touch_t *touch;
+    uint16_t             touch_count;
+} scene_t;
+
+// Taps land inside the sketch's hit regions; the swipe starts in the dino's box
+static const scene_touch_t tap_pizza[]  = { {100, true, 60, 180},  {130, false, 60, 180} };
+static const scene_touch_t tap_burger[] = { {100, true, 180, 180}, {130, false, 180, 180} };
+static const scene_touch_t tap_bed[]    = { {100, true, 120, 190}, {130, false, 120, 190} };
+static const scene_touch_t swipe_left[] = {
+    {100, true, 130, 120}, {110, true, 120, 120}, {120, true, 110, 120},
+    {130, true, 100, 120}, {140, true,  90, 120}, {150, true,  80, 120},
+    {160, false, 80, 120},
+};
+
+#define SCENE(name, frames, trace) { name, frames, trace, sizeof(trace) / sizeof(trace[0]) }
+
+static const scene_t scenes[] = {
+    { "idle_dino", 120, NULL, 0 },
+    SCENE("pizza_spin",     120, tap_pizza),    // 1.6 s spin
+    SCENE("burger_spin",    120, tap_burger),
+    SCENE("bed_spin",       150, tap_bed),      // 2 s spin, then the capture arms
+    SCENE("swipe_left_pet",  60, swipe_left),   // 600 ms pet
+};
+
+#define SCENE_COUNT (sizeof(scenes) / sizeof(scenes[0]))
+
+//----------------------- One run ------------------------
+
+typedef struct {
+    uint32_t frames;
+    uint64_t wall_ns;                   // loop() passes only, not boot
+    xiao_flush_stats_t flush;
+    stack_inval_stats_t inval;
+    uint64_t scope_us[PROF_SCOPE_COUNT];
+    uint32_t stale_px;                  // differ from a full redraw at the end
+    uint64_t hash[RENDER_MAX_FRAMES];
+} scene_result_t;
+
+// FNV-1a, 64 bit
+static uint64_t frame_hash(void)
+{
+    const uint8_t *p = (const uint8_t *)xiao_host_framebuffer;
+    uint64_t h = 14695981039346656037ULL;
+    for (size_t i = 0; i < sizeof(xiao_host_framebuffer); i++) {
+        h = (h ^ p[i]) * 1099511628211ULL;
+    }
+    return h;
+}
+
+// Pixels the partial refreshes got wrong: draws what is still pending, then
+// the whole screen again, and counts the pixels that changed. Nothing runs
+// in between, so both draws see the same objects.
+static uint32_t stale_pixels(void)
+{
+    static uint16_t partial[SCREEN_WIDTH * SCREEN_HEIGHT];
+
+    lv_refr_now(NULL);
+    xiao_bus_done();
+    memcpy(partial, xiao_host_framebuffer, sizeof(partial));
+
+    lv_obj_invalidate(lv_scr_act());
+    lv_refr_now(NULL);
+    xiao_bus_done();
+
+    uint32_t stale = 0;
+    for (size_t i = 0; i < SCREEN_WIDTH * SCREEN_HEIGHT; i++) {
+        stale += partial[i] != xiao_host_framebuffer[i];
+    }
+    return stale;
+}
+
+// Runs in the child: boot, replay, hash every frame
+static void run_scene(const scene_t *scene, uint32_t frames, scene_result_t *out)
+{
+    host_clock::set_stepped(true);
+    for (uint16_t i = 0; i < scene->touch_count; i++) {
+        const scene_touch_t *t = &scene->touch[i];
+        chsc6x_fake.add(t->ms, t->down, t->x, t->y);
+    }
+    chsc6x_fake.rewind();
+
+    setup();
+    prof_reset();
+    xiao_flush_stats_reset();
+    stack_inval_stats_reset();
+
+    uint32_t start_ms = millis();
+    std::chrono::steady_clock::time_point wall_start = std::chrono::steady_clock::now();
+    chsc6x_fake.follow(start_ms);
+    for (uint32_t f = 0; f < frames; f++) {
+        chsc6x_fake.run_until(millis() - start_ms);
+        loop();
+        xiao_bus_done();   // the last strip lands before the frame is hashed
+        out->hash[f] = frame_hash();
+    }
+    out->wall_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now() - wall_start).count();
+    out->frames = frames;
+    out->flush  = *xiao_flush_stats();
+    out->inval  = *stack_inval_stats();
+    for (int i = 0; i < PROF_SCOPE_COUNT; i++) {
+        out->scope_us[i] = prof_scope((prof_scope_id_t)i)->total_us;
+    }
+    out->stale_px = stale_pixels();
+}
+
+// Forks, runs the scene in the child and collects its result over a pipe
+static bool run_isolated(const scene_t *scene, uint32_t frames, bool verbose, scene_result_t *out)
+{
+    int fds[2];
+    if (pipe(fds) != 0) {
+        return false;
+    }
+    fflush(stdout);
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        if (!verbose && !freopen("/dev/null", "w", stdout)) {
+            _exit(3);
+        }
+        static scene_result_t result;
+        run_scene(scene, frames, &result);
+        fflush(stdout);
+        const uint8_t *p = (const uint8_t *)&result;
+        size_t left = sizeof(result);
+        while (left > 0) {
+            ssize_t n = write(fds[1], p, left);
+            if (n <= 0) {
+                _exit(2);
+            }
+            p += n;
+            left -= n;
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    if (pid < 0) {
+        close(fds[0]);
+        return false;
+    }
+
+    uint8_t *p = (uint8_t *)out;
+    size_t got = 0;
+    while (got < sizeof(*out)) {
+        ssize_t n = read(fds[0], p + got, sizeof(*out) - got);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        got += n;
+    }
+    close(fds[0]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    if (WIFSIGNALED(status)) {
+        fprintf(stderr, "%s: crashed with signal %d\n", scene->name, WTERMSIG(status));
+    }
+    return got == sizeof(*out) && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+//----------------------- Goldens ------------------------
+
+static std::string golden_path(const char *dir, const scene_t *scene)
+{
+    return std::string(dir) + "/" + scene->name + ".golden";
+}
+
+static bool golden_read(const std::string &path, std::vector<uint64_t> *hashes)
+{
+    FILE *in = fopen(path.c_str(), "r");
+    if (!in) {
+        return false;
+    }
+    char line[256];
+    while (fgets(line, sizeof(line), in)) {
+        if (line[0] == '#' || line[0] == '\n') {
+            continue;
+        }
+        hashes->push_back(strtoull(line, NULL, 16));
+    }
+    fclose(in);
+    return true;
+}
+
+static bool golden_write(const char *dir, const scene_t *scene, const scene_result_t *result)
+{
+    mkdir(dir, 0755);
+    FILE *out = fopen(golden_path(dir, scene).c_str(), "w");
+    if (!out) {
+        return false;
+    }
+    fprintf(out, "# %s: FNV-1a 64 of the %dx%d RGB565 framebuffer after each loop() pass\n",
+            scene->name, SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (uint32_t f = 0; f < result->frames; f++) {
+        fprintf(out, "%016llx\n", (unsigned long long)result->hash[f]);
+    }
+    return fclose(out) == 0;
+}
+
+// Returns a short verdict for the table; false if the scene fails the check
+static bool golden_check(const char *dir, const scene_t *scene, const scene_result_t *result,
+                         char *verdict, size_t len)
+{
+    std::vector<uint64_t> golden;
+    if (!golden_read(golden_path(dir, scene), &golden)) {
+        snprintf(verdict, len, "no golden");
+        return false;
+    }
+    // A shorter --frames run checks a prefix
+    if (golden.size() < result->frames) {
+        snprintf(verdict, len, "golden has %u frames", (unsigned)golden.size());
+        return false;
+    }
+    uint32_t differ = 0, first = 0;
+    for (uint32_t f = 0; f < result->frames; f++) {
+        if (golden[f] != result->hash[f]) {
+            if (differ++ == 0) {
+                first = f;
+            }
+        }
+    }
+    if (differ) {
+        snprintf(verdict, len, "DIFF %u frames, first #%u", differ, first);
+        return false;
+    }
+    snprintf(verdict, len, "ok");
+    return true;
+}
+
+//----------------------- Report ------------------------
+
+static void print_header(void)
+{
+    printf("%-15s %6s %9s %10s %8s %9s %9s %9s %9s %8s %9s %9s %6s %9s  %s\n",
+           "scene", "frames", "frames/s", "flush KB", "flushes",
+           "flush us", "lvgl us", "exec us", "comp us",
+           "updates", "layer px", "inval px", "saved", "max px", "golden");
+}
+
+// Times and areas are per-frame averages: the flush callback,
+// lv_timer_handler(), the sprite exec callbacks and stack compositing, then
+// the bracketed stack updates, what their objects would invalidate one by one
+// against what the union invalidation marked, the share of it saved and the
+// largest union one frame marked
+static void print_row(const scene_t *scene, const scene_result_t *r, const char *verdict)
+{
+    double n = r->frames ? r->frames : 1;
+    double saved = r->inval.layer_px
+                 ? 100.0 * (1.0 - (double)r->inval.union_px / r->inval.layer_px) : 0.0;
+    printf("%-15s %6u %9.1f %10.1f %8u %9.1f %9.1f %9.1f %9.1f %8u %9.0f %9.0f %5.1f%% %9u  %s\n",
+           scene->name, r->frames,
+           r->wall_ns ? r->frames * 1e9 / r->wall_ns : 0.0,
+           r->flush.bytes / 1024.0, r->flush.flushes,
+           r->flush.flush_us / n,
+           r->scope_us[PROF_LVGL] / n,
+           r->scope_us[PROF_SPRITE_EXEC] / n,
+           r->scope_us[PROF_COMPOSE] / n,
+           r->inval.updates,
+           r->inval.layer_px / n,
+           r->inval.union_px / n,
+           saved,
+           r->inval.max_frame_union_px,
+           verdict);
+}
+
+static void usage(const char *argv0)
+{
+    fprintf(stderr, "usage: %s [--scene NAME] [--frames N] [--update] [--golden DIR] [--verbose]\n",
+            argv0);
+    fprintf(stderr, "scenes:");
+    for (size_t i = 0; i < SCENE_COUNT; i++) {
+        fprintf(stderr, " %s", scenes[i].name);
+    }
+    fprintf(stderr, "\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *only    = NULL;
+    const char *dir     = RENDER_GOLDEN_DIR;
+    uint32_t    frames  = 0;
+    bool        update  = false;
+    bool        verbose = false;
+
+    for (int i = 1; i < argc; i++) {
+        bool has_value = i + 1 < argc;
+        if (!strcmp(argv[i], "--scene") && has_value) {
+            only = argv[++i];
+        } else if (!strcmp(argv[i], "--frames") && has_value) {
+            frames = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (!strcmp(argv[i], "--golden") && has_value) {
+            dir = argv[++i];
+        } else if (!strcmp(argv[i], "--update")) {
+            update = true;
+        } else if (!strcmp(argv[i], "--verbose")) {
+            verbose = true;
+        } else {
+            usage(argv[0]);
+            return 2;
+        }
+    }
+    if (frames > RENDER_MAX_FRAMES) {
+        frames = RENDER_MAX_FRAMES;
+    }
+
+    static scene_result_t result;
+    int  ran    = 0;
+    bool failed = false;
+    print_header();
+    for (size_t i = 0; i < SCENE_COUNT; i++) {
+        const scene_t *scene = &scenes[i];
+        if (only && strcmp(only, scene->name)) {
+            continue;
+        }
+        ran++;
+
+        memset(&result, 0, sizeof(result));
+        if (!run_isolated(scene, frames ? frames : scene->frames, verbose, &result)) {
+            printf("%-15s failed to run\n", scene->name);
+            failed = true;
+            continue;
+        }
+
+        char verdict[48];
+        if (result.stale_px) {
+            snprintf(verdict, sizeof(verdict), "STALE %u px", result.stale_px);
+            failed = true;
+        } else if (update) {
+            bool ok = golden_write(dir, scene, &result);
+            snprintf(verdict, sizeof(verdict), ok ? "updated" : "write failed");
+            failed |= !ok;
+        } else {
+            failed |= !golden_check(dir, scene, &result, verdict, sizeof(verdict));
+        }
+        print_row(scene, &result, verdict);
+    }
+
+    if (ran == 0) {
+        usage(argv[0]);
+        return 2;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,3 @@
+// The .ino as a C++ translation unit. The Arduino builder does the same
+// after adding prototypes, which the sketch declares itself where it needs them.
+#include "round_display_image_2.5D.ino"
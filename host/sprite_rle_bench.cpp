@@ -0,0 +1,266 @@
+// Flash size and decode throughput of the sprite_rle.h layers against the raw
+// TRUE_COLOR_ALPHA arrays they replace.
+//
+//   sprite_rle_bench [--iterations N]
+//
+//   --iterations N  times every set is decoded for the timing (default 2000)
+//
+// Every raw layer is encoded in memory with the converter's encoder and
+// decoded back with the sketch's decoder, both as a whole layer, as row
+// ranges through the scratch (what the compositor does, for layers that fit
+// it) and in short row windows (what LVGL's read_line asks for), and compared
+// byte for byte. The committed *_rle.h assets are checked
+// against their raw headers the same way, so a stale asset fails the run.
+// my_img.h stands in for the 64x64 dino slices, whose header isn't part of
+// the tree.
+//
+// Exits 1 if anything decodes differently from the raw pixels.
+#include <lvgl.h>
+#include "sprite_rle.h"
+#include "sprite_rle_encode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "my_img.h"
+#include "pizza.h"
+#include "burger.h"
+#include "bed.h"
+
+// Same descriptor names as the raw ones, so they get their own namespace
+namespace rle {
+#include "pizza_rle.h"
+#include "burger_rle.h"
+#include "bed_rle.h"
+}
+
+#define PX_SIZE LV_IMG_PX_SIZE_ALPHA_BYTE
+
+struct layer_set_t {
+    const char                 *name;
+    const lv_img_dsc_t *const  *raw;
+    const lv_img_dsc_t *const  *committed;   // NULL: no asset header in the tree
+    size_t                      count;
+};
+
+static const lv_img_dsc_t *const slices_raw[] = {
+    &tile000, &tile001, &tile002, &tile003, &tile004, &tile005, &tile006, &tile007,
+};
+static const lv_img_dsc_t *const pizza_raw[] = {&pizza000, &pizza001, &pizza002, &pizza003};
+static const lv_img_dsc_t *const pizza_rle[] = {
+    &rle::pizza000, &rle::pizza001, &rle::pizza002, &rle::pizza003,
+};
+static const lv_img_dsc_t *const burger_raw[] = {
+    &burger000, &burger001, &burger002, &burger003, &burger004, &burger005, &burger006, &burger007,
+};
+static const lv_img_dsc_t *const burger_rle[] = {
+    &rle::burger000, &rle::burger001, &rle::burger002, &rle::burger003,
+    &rle::burger004, &rle::burger005, &rle::burger006, &rle::burger007,
+};
+static const lv_img_dsc_t *const bed_raw[] = {
+    &bed000, &bed001, &bed002, &bed003, &bed004, &bed005, &bed006, &bed007,
+};
+static const lv_img_dsc_t *const bed_rle[] = {
+    &rle::bed000, &rle::bed001, &rle::bed002, &rle::bed003,
+    &rle::bed004, &rle::bed005, &rle::bed006, &rle::bed007,
+};
+
+#define SET(name, raw, committed) {name, raw, committed, sizeof(raw) / sizeof(raw[0])}
+static const layer_set_t sets[] = {
+    SET("slices 64x64", slices_raw, (const lv_img_dsc_t *const *)NULL),
+    SET("pizza 16x16",  pizza_raw,  pizza_rle),
+    SET("burger 16x16", burger_raw, burger_rle),
+    SET("bed 32x32",    bed_raw,    bed_rle),
+};
+#undef SET
+
+// An encoded layer with the descriptor the sketch would see
+struct encoded_layer_t {
+    sprite_rle_encoded data;
+    sprite_rle_t       rle;
+    lv_img_dsc_t       img;
+};
+
+//----------------------- Round trip ------------------------
+
+// Every row of the layer into 'out'; the slices are larger than the scratch
+static void decode_layer(const lv_img_dsc_t *img, uint8_t *out)
+{
+    lv_coord_t w = img->header.w;
+    for (lv_coord_t y = 0; y < (lv_coord_t)img->header.h; y++) {
+        sprite_rle_decode_row(img, y, 0, w, out + (size_t)y * w * PX_SIZE);
+    }
+}
+
+// Whole layer, row ranges through the scratch, then every row in windows of
+// a few lengths and offsets
+static bool same_pixels(const lv_img_dsc_t *img, const lv_img_dsc_t *raw, const char *what)
+{
+    lv_coord_t w = raw->header.w;
+    lv_coord_t h = raw->header.h;
+    size_t     bytes = (size_t)w * h * PX_SIZE;
+
+    std::vector<uint8_t> unpacked(bytes);
+    decode_layer(img, unpacked.data());
+    if (memcmp(unpacked.data(), raw->data, bytes) != 0) {
+        printf("%s: layer differs\n", what);
+        return false;
+    }
+
+    if (bytes <= SPRITE_RLE_SCRATCH_BYTES) {
+        const lv_coord_t ranges[][2] = { {0, (lv_coord_t)(h - 1)}, {1, (lv_coord_t)(h / 2)},
+                                         {(lv_coord_t)(h - 1), (lv_coord_t)(h - 1)} };
+        for (const lv_coord_t *r : ranges) {
+            const uint8_t *rows = sprite_rle_unpack(img, r[0], r[1]);
+            size_t         len  = (size_t)(r[1] - r[0] + 1) * w * PX_SIZE;
+            if (!rows || memcmp(rows, raw->data + (size_t)r[0] * w * PX_SIZE, len) != 0) {
+                printf("%s: rows %d..%d %s\n", what, r[0], r[1],
+                       rows ? "differ" : "don't fit the scratch");
+                return false;
+            }
+        }
+    }
+
+    static const lv_coord_t windows[] = {1, 3, 7, 16};
+    std::vector<uint8_t> line((size_t)w * PX_SIZE);
+    for (lv_coord_t y = 0; y < h; y++) {
+        for (lv_coord_t len : windows) {
+            for (lv_coord_t x = 0; x + len <= w; x += len) {
+                sprite_rle_decode_row(img, y, x, len, line.data());
+                const uint8_t *expect = raw->data + ((size_t)y * w + x) * PX_SIZE;
+                if (memcmp(line.data(), expect, (size_t)len * PX_SIZE) != 0) {
+                    printf("%s: row %d, x %d..%d differs\n", what, y, x, x + len - 1);
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+static bool encode(const lv_img_dsc_t *raw, encoded_layer_t *out)
+{
+    std::string error;
+    if (!sprite_rle_encode(raw->data, raw->header.w, raw->header.h, &out->data, &error)) {
+        printf("encode: %s\n", error.c_str());
+        return false;
+    }
+
+    out->rle.magic         = SPRITE_RLE_MAGIC;
+    out->rle.palette_count = (uint16_t)out->data.palette_count();
+    out->rle.palette       = out->data.palette.data();
+    out->rle.rows          = out->data.rows.data();
+    out->rle.runs          = out->data.runs.data();
+
+    memset(&out->img, 0, sizeof(out->img));
+    out->img.header.cf = SPRITE_RLE_CF;
+    out->img.header.w  = raw->header.w;
+    out->img.header.h  = raw->header.h;
+    out->img.data_size = sizeof(out->rle);
+    out->img.data      = (const uint8_t *)&out->rle;
+    return true;
+}
+
+//----------------------- Timing ------------------------
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static volatile uint8_t sink;
+
+// The raw layers only have to be read; a copy stands in for that
+#define LAYER_MAX_BYTES (64 * 64 * PX_SIZE)   // the slices
+
+static double time_raw(const layer_set_t *set, uint32_t iterations)
+{
+    std::vector<uint8_t> copy(LAYER_MAX_BYTES);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (size_t i = 0; i < set->count; i++) {
+            const lv_img_dsc_t *raw = set->raw[i];
+            memcpy(copy.data(), raw->data, (size_t)raw->header.w * raw->header.h * PX_SIZE);
+            sink = copy[n % copy.size()];
+        }
+    }
+    return elapsed_us(start);
+}
+
+static double time_rle(const std::vector<encoded_layer_t> &layers, uint32_t iterations)
+{
+    std::vector<uint8_t> out(LAYER_MAX_BYTES);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t n = 0; n < iterations; n++) {
+        for (const encoded_layer_t &layer : layers) {
+            decode_layer(&layer.img, out.data());
+            sink = out[n % 64];
+        }
+    }
+    return elapsed_us(start);
+}
+
+//----------------------- Main ------------------------
+
+int main(int argc, char **argv)
+{
+    uint32_t iterations = 2000;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--iterations") && i + 1 < argc) {
+            iterations = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--iterations N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (iterations == 0) {
+        iterations = 1;
+    }
+
+    bool ok = true;
+    printf("%-13s %6s %8s %8s %6s %9s %9s %9s %9s  %s\n", "set", "layers", "raw B", "rle B",
+           "ratio", "raw us", "rle us", "raw Mpx/s", "rle Mpx/s", "check");
+
+    for (const layer_set_t &set : sets) {
+        std::vector<encoded_layer_t> layers(set.count);
+        size_t raw_bytes = 0, rle_bytes = 0, pixels = 0;
+        bool   same = true;
+
+        for (size_t i = 0; i < set.count; i++) {
+            const lv_img_dsc_t *raw = set.raw[i];
+            std::string what = std::string(set.name) + " #" + std::to_string(i);
+            if (!encode(raw, &layers[i])) {
+                same = false;
+                continue;
+            }
+            same &= same_pixels(&layers[i].img, raw, what.c_str());
+            if (set.committed) {
+                same &= same_pixels(set.committed[i], raw, (what + " (committed)").c_str());
+            }
+
+            pixels    += (size_t)raw->header.w * raw->header.h;
+            raw_bytes += (size_t)raw->header.w * raw->header.h * PX_SIZE;
+            rle_bytes += layers[i].data.bytes();
+        }
+        if (!same) {
+            ok = false;
+            printf("%-13s failed the round trip\n", set.name);
+            continue;
+        }
+
+        double raw_us = time_raw(&set, iterations) / iterations;
+        double rle_us = time_rle(layers, iterations) / iterations;
+        printf("%-13s %6zu %8zu %8zu %5.1f%% %9.2f %9.2f %9.0f %9.0f  %s\n", set.name, set.count,
+               raw_bytes, rle_bytes, 100.0 * rle_bytes / raw_bytes,
+               raw_us / set.count, rle_us / set.count, pixels / raw_us, pixels / rle_us,
+               set.committed ? "ok, assets ok" : "ok");
+    }
+
+    printf("\nraw/rle us: per layer, one whole-layer decode (a read for raw)\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,274 @@
+// Turns an LVGL image header (TRUE_COLOR_ALPHA arrays as written by LVGL's
+// image converter, like pizza.h) into the sprite_rle.h format.
+//
+//   g++ -O2 -o sprite_rle_convert sprite_rle_convert.cpp
+//   ./sprite_rle_convert ../pizza.h > ../pizza_rle.h
+//
+// Both 16-bit variants (LV_COLOR_16_SWAP 0 and 1) are read. They share one
+// stream of runs; only the palette bytes differ. Descriptors keep their
+// names, so the output is a drop-in replacement for the input. The header
+// also records its largest layer as <NAME>_RLE_MAX_LAYER_BYTES and checks it
+// against the decoder's scratch. Sizes go to stderr.
+#include "sprite_rle_encode.h"
+
+#include <algorithm>
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+struct image_t {
+    std::string          name;            // descriptor
+    std::string          map;             // pixel array it points at
+    int                  w = 0;
+    int                  h = 0;
+    bool                 alpha = false;   // LV_IMG_CF_TRUE_COLOR_ALPHA
+};
+
+struct map_t {
+    std::string          name;
+    std::vector<uint8_t> px[2];           // [LV_COLOR_16_SWAP]
+};
+
+//----------------------- Parsing ------------------------
+
+static bool starts_with(const std::string &s, const char *prefix)
+{
+    return s.compare(0, strlen(prefix), prefix) == 0;
+}
+
+// Text between 'before' and 'after' on the line, or "" if either is missing
+static std::string between(const std::string &line, const char *before, const char *after)
+{
+    size_t start = line.find(before);
+    if (start == std::string::npos) {
+        return "";
+    }
+    start += strlen(before);
+    size_t end = line.find(after, start);
+    return end == std::string::npos ? "" : line.substr(start, end - start);
+}
+
+static std::string trim(const std::string &s)
+{
+    size_t a = s.find_first_not_of(" \t\r");
+    size_t b = s.find_last_not_of(" \t\r,");
+    return a == std::string::npos ? "" : s.substr(a, b - a + 1);
+}
+
+static bool parse(FILE *in, std::vector<map_t> *maps, std::vector<image_t> *images)
+{
+    char        buf[8192];
+    std::string line;
+    int         variant = -1;      // which 16-bit block we're in, -1 = none
+    map_t      *map     = NULL;
+    image_t    *image   = NULL;
+
+    while (fgets(buf, sizeof(buf), in)) {
+        line += buf;
+        if (line.empty() || line.back() != '\n') {
+            continue;              // longer than buf, keep reading
+        }
+
+        std::string name = between(line, "uint8_t ", "[] = {");
+        if (!name.empty()) {
+            maps->push_back(map_t());
+            map = &maps->back();
+            map->name = name;
+            image = NULL;
+        } else if (!(name = between(line, "lv_img_dsc_t ", " = {")).empty()) {
+            images->push_back(image_t());
+            image = &images->back();
+            image->name = name;
+            map = NULL;
+        } else if (starts_with(line, "#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0")) {
+            variant = 0;
+        } else if (starts_with(line, "#if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0")) {
+            variant = 1;
+        } else if (starts_with(line, "#if") || starts_with(line, "#endif")) {
+            variant = -1;
+        } else if (map && variant >= 0) {
+            for (size_t at = line.find("0x"); at != std::string::npos; at = line.find("0x", at + 2)) {
+                map->px[variant].push_back((uint8_t)strtoul(line.c_str() + at, NULL, 16));
+            }
+        } else if (image) {
+            std::string v;
+            if (!(v = between(line, ".w =", "\n")).empty()) {
+                image->w = atoi(trim(v).c_str());
+            } else if (!(v = between(line, ".h =", "\n")).empty()) {
+                image->h = atoi(trim(v).c_str());
+            } else if (!(v = between(line, ".cf =", "\n")).empty()) {
+                image->alpha = trim(v) == "LV_IMG_CF_TRUE_COLOR_ALPHA";
+            } else if (!(v = between(line, ".data =", "\n")).empty()) {
+                image->map = trim(v);
+            }
+        }
+        line.clear();
+    }
+    return !images->empty();
+}
+
+//----------------------- Output ------------------------
+
+static void print_bytes(const uint8_t *data, size_t n, size_t per_line)
+{
+    for (size_t i = 0; i < n; i++) {
+        printf("%s0x%02x,%s", i % per_line ? " " : "  ", data[i],
+               (i % per_line == per_line - 1 || i == n - 1) ? "\n" : "");
+    }
+}
+
+static void print_image(const image_t &image, const sprite_rle_encoded &enc,
+                        const std::vector<uint8_t> &swapped_palette)
+{
+    const char *n = image.name.c_str();
+
+    printf("// %s: %dx%d, %zu colours, %zu bytes (raw %d)\n", n, image.w, image.h,
+           enc.palette_count(), enc.bytes(), image.w * image.h * SPRITE_RLE_PX_SIZE);
+    printf("static const uint8_t %s_palette[] = {\n", n);
+    printf("#if LV_COLOR_16_SWAP == 0\n");
+    print_bytes(enc.palette.data(), enc.palette.size(), 12);
+    printf("#else\n");
+    print_bytes(swapped_palette.data(), swapped_palette.size(), 12);
+    printf("#endif\n};\n");
+
+    printf("static const uint16_t %s_rows[] = {\n", n);
+    for (size_t i = 0; i < enc.rows.size(); i++) {
+        printf("%s%u,%s", i % 16 ? " " : "  ", enc.rows[i],
+               (i % 16 == 15 || i == enc.rows.size() - 1) ? "\n" : "");
+    }
+    printf("};\n");
+
+    printf("static const LV_ATTRIBUTE_LARGE_CONST uint8_t %s_runs[] = {\n", n);
+    print_bytes(enc.runs.data(), enc.runs.size(), 16);
+    printf("};\n");
+
+    printf("static const sprite_rle_t %s_rle = {\n", n);
+    printf("  SPRITE_RLE_MAGIC, %zu, %s_palette, %s_rows, %s_runs\n", enc.palette_count(), n, n, n);
+    printf("};\n\n");
+
+    printf("const lv_img_dsc_t %s = {\n", n);
+    printf("  .header = {\n");
+    printf("      .cf = SPRITE_RLE_CF,\n");
+    printf("      .always_zero = 0,\n");
+    printf("      .reserved = 0,\n");
+    printf("      .w = %d,\n", image.w);
+    printf("      .h = %d,\n", image.h);
+    printf("  },\n");
+    printf("  .data_size = sizeof(%s_rle),\n", n);
+    printf("  .data = (const uint8_t *)&%s_rle,\n", n);
+    printf("};\n\n");
+}
+
+static std::string file_name(const char *path)
+{
+    std::string name = path;
+    size_t slash = name.find_last_of("/\\");
+    return slash == std::string::npos ? name : name.substr(slash + 1);
+}
+
+static std::string guard_name(const char *path)
+{
+    std::string base = file_name(path);
+    base = base.substr(0, base.find('.'));
+
+    std::string guard;
+    for (char c : base) {
+        guard += isalnum((unsigned char)c) ? (char)toupper((unsigned char)c) : '_';
+    }
+    return guard + "_RLE_H";
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <lvgl image header> > <output header>\n", argv[0]);
+        return 2;
+    }
+    FILE *in = fopen(argv[1], "r");
+    if (!in) {
+        perror(argv[1]);
+        return 1;
+    }
+
+    std::vector<map_t>   maps;
+    std::vector<image_t> images;
+    bool ok = parse(in, &maps, &images);
+    fclose(in);
+    if (!ok) {
+        fprintf(stderr, "%s: no image descriptors found\n", argv[1]);
+        return 1;
+    }
+
+    std::string guard = guard_name(argv[1]);
+    printf("// Generated by host/sprite_rle_convert from %s; see sprite_rle.h\n",
+           file_name(argv[1]).c_str());
+    printf("#ifndef %s\n#define %s\n\n", guard.c_str(), guard.c_str());
+    printf("#include \"sprite_rle.h\"\n\n");
+    printf("#if LV_COLOR_DEPTH != 16\n");
+    printf("#error \"the palettes are RGB565 + A8; regenerate from the raw header for other depths\"\n");
+    printf("#endif\n\n");
+
+    size_t raw_total = 0, rle_total = 0, largest = 0;
+    for (const image_t &image : images) {
+        const map_t *map = NULL;
+        for (const map_t &m : maps) {
+            if (m.name == image.map) {
+                map = &m;
+            }
+        }
+
+        size_t expected = (size_t)image.w * image.h * SPRITE_RLE_PX_SIZE;
+        if (!image.alpha || !map || map->px[0].size() != expected || map->px[1].size() != expected) {
+            fprintf(stderr, "%s: not a 16-bit TRUE_COLOR_ALPHA image with both byte orders\n",
+                    image.name.c_str());
+            return 1;
+        }
+
+        sprite_rle_encoded enc;
+        std::string        error;
+        if (!sprite_rle_encode(map->px[0].data(), image.w, image.h, &enc, &error)) {
+            fprintf(stderr, "%s: %s\n", image.name.c_str(), error.c_str());
+            return 1;
+        }
+
+        // The swapped block must be the same pixels with the colour bytes
+        // swapped, so the runs fit it too
+        for (size_t i = 0; i < expected; i += SPRITE_RLE_PX_SIZE) {
+            const uint8_t *a = &map->px[0][i];
+            const uint8_t *b = &map->px[1][i];
+            if (a[0] != b[1] || a[1] != b[0] || a[2] != b[2]) {
+                fprintf(stderr, "%s: byte-swapped block doesn't match\n", image.name.c_str());
+                return 1;
+            }
+        }
+        std::vector<uint8_t> swapped;
+        for (uint32_t at : enc.first_use) {
+            const uint8_t *p = &map->px[1][(size_t)at * SPRITE_RLE_PX_SIZE];
+            swapped.insert(swapped.end(), p, p + SPRITE_RLE_PX_SIZE);
+        }
+
+        print_image(image, enc, swapped);
+        raw_total += expected;
+        rle_total += enc.bytes();
+        largest    = std::max(largest, expected);
+        fprintf(stderr, "%-12s %3dx%-3d %3zu colours %6zu -> %5zu bytes\n", image.name.c_str(),
+                image.w, image.h, enc.palette_count(), expected, enc.bytes());
+    }
+
+    // What sprite_rle_unpack() needs for these layers; SPRITE_RLE_MAX_LAYER_BYTES
+    // is sized from the largest of these across the asset headers
+    std::string max_name = guard.substr(0, guard.size() - 2) + "_MAX_LAYER_BYTES";
+    printf("// Largest layer unpacked\n");
+    printf("#define %s %zu\n", max_name.c_str(), largest);
+    printf("#if SPRITE_RLE_ASSETS\n");
+    printf("static_assert(%s <= SPRITE_RLE_SCRATCH_BYTES,\n", max_name.c_str());
+    printf("              \"a layer outgrew the scratch; raise SPRITE_RLE_MAX_LAYER_BYTES\");\n");
+    printf("#endif\n\n");
+
+    printf("#endif // %s\n", guard.c_str());
+    fprintf(stderr, "total %zu -> %zu bytes (%.1f%%), largest layer %zu bytes\n", raw_total,
+            rle_total, 100.0 * rle_total / raw_total, largest);
+    return 0;
+}
@@ -0,0 +1,89 @@
+// Encoder for the sprite_rle.h layer format, shared by sprite_rle_convert
+// (which writes the asset headers) and sprite_rle_bench (which encodes the
+// raw arrays in memory to compare against them).
+#ifndef SPRITE_RLE_ENCODE_H
+#define SPRITE_RLE_ENCODE_H
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#define SPRITE_RLE_PX_SIZE 3   // RGB565 + alpha, as LV_IMG_PX_SIZE_ALPHA_BYTE at 16 bit
+
+struct sprite_rle_encoded {
+    std::vector<uint8_t>  palette;      // SPRITE_RLE_PX_SIZE bytes per entry
+    std::vector<uint32_t> first_use;    // pixel where each entry first shows up
+    std::vector<uint16_t> rows;         // offset of each row's runs
+    std::vector<uint8_t>  runs;
+
+    size_t palette_count() const { return palette.size() / SPRITE_RLE_PX_SIZE; }
+
+    // What the arrays take in flash; the descriptors aren't counted, as for raw
+    size_t bytes() const { return palette.size() + rows.size() * sizeof(uint16_t) + runs.size(); }
+};
+
+// A pixel is transparent only if all of its bytes are zero; anything else,
+// even alpha 0 with colour bits set, goes through the palette so the
+// round trip stays exact.
+static inline bool sprite_rle_px_empty(const uint8_t *px)
+{
+    return px[0] == 0 && px[1] == 0 && px[2] == 0;
+}
+
+/**
+ * Encodes w x h TRUE_COLOR_ALPHA pixels. Fails (with 'error' set) past 256
+ * colours or 64 KB of runs, which the format can't address.
+ */
+static inline bool sprite_rle_encode(const uint8_t *px, int w, int h,
+                                     sprite_rle_encoded *out, std::string *error)
+{
+    *out = sprite_rle_encoded();
+
+    for (int y = 0; y < h; y++) {
+        if (out->runs.size() > 0xFFFF) {
+            *error = "runs exceed 64 KB";
+            return false;
+        }
+        out->rows.push_back((uint16_t)out->runs.size());
+
+        const uint8_t *row = px + (size_t)y * w * SPRITE_RLE_PX_SIZE;
+        int x = 0;
+        while (x < w) {
+            int skip = 0;
+            while (x + skip < w && skip < 255 && sprite_rle_px_empty(row + (x + skip) * SPRITE_RLE_PX_SIZE)) {
+                skip++;
+            }
+            x += skip;
+
+            int count = 0;
+            while (x + count < w && count < 255 && !sprite_rle_px_empty(row + (x + count) * SPRITE_RLE_PX_SIZE)) {
+                count++;
+            }
+
+            out->runs.push_back((uint8_t)skip);
+            out->runs.push_back((uint8_t)count);
+            for (int i = 0; i < count; i++) {
+                const uint8_t *p = row + (x + i) * SPRITE_RLE_PX_SIZE;
+                size_t index = 0;
+                while (index < out->palette_count() &&
+                       memcmp(&out->palette[index * SPRITE_RLE_PX_SIZE], p, SPRITE_RLE_PX_SIZE) != 0) {
+                    index++;
+                }
+                if (index == out->palette_count()) {
+                    if (index == 256) {
+                        *error = "more than 256 colours";
+                        return false;
+                    }
+                    out->palette.insert(out->palette.end(), p, p + SPRITE_RLE_PX_SIZE);
+                    out->first_use.push_back((uint32_t)(y * w + x + i));
+                }
+                out->runs.push_back((uint8_t)index);
+            }
+            x += count;
+        }
+    }
+    return true;
+}
+
+#endif // SPRITE_RLE_ENCODE_H
@@ -0,0 +1,157 @@
+// Replays short touch traces through touch_events.cpp and the CHSC6X fake
+// and checks the DOWN / MOVE / UP events that come out.
+//
+//   touch_events_check
+//
+// Every pass is shaped like the sketch's loop(): touch_events_update(), a
+// render during which nothing polls the controller (reports still arrive),
+// then touch_events_wait() for the idle time. The traces are what coalescing
+// one read per pass used to lose: a 5 ms tap that starts and ends between
+// two passes.
+//
+// Exits 1 if any trace gives different events.
+#include <Arduino.h>
+
+#define CHSC6X_FAKE_IMPLEMENTATION
+#include "chsc6x_fake.h"
+#include "touch_events.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+// touch_events_begin() hooks these in the display driver; there is none here
+lv_indev_t *lv_xiao_touch_indev(void)
+{
+    return NULL;
+}
+
+void lv_xiao_disp_set_poll_cb(void (*cb)(void))
+{
+    (void)cb;
+}
+
+//----------------------- Traces ------------------------
+
+typedef struct {
+    uint32_t ms;
+    bool     down;
+    int16_t  x, y;
+} sample_t;
+
+typedef struct {
+    uint8_t    type;   // touch_ev_type_t
+    lv_coord_t x, y;
+} expected_event_t;
+
+typedef struct {
+    const char             *name;
+    uint32_t                render_ms;   // per pass, without polling
+    uint32_t                idle_ms;     // per pass, in touch_events_wait()
+    const sample_t         *samples;
+    uint16_t                sample_count;
+    const expected_event_t *events;
+    uint16_t                event_count;
+    uint32_t                unseen;      // expected stats.unseen
+} trace_t;
+
+// Passes start every 20 ms: render 0..4, idle 4..20. The tap is down from
+// 30 to 35 ms, one report sees it, the next one sees it gone.
+static const sample_t tap_idle[] = { {30, true, 60, 180}, {35, false, 60, 180} };
+static const expected_event_t tap_idle_events[] = {
+    {TOUCH_EV_DOWN, 60, 180}, {TOUCH_EV_UP, 60, 180},
+};
+
+// Passes start every 46 ms: render 0..30, idle 30..46. The first tap is
+// read in the idle time as usual; the second one (100..105 ms) has both its
+// reports inside a render. Its point was never read, so it is only counted
+// as unseen; nothing may come out at the first tap's point.
+static const sample_t tap_render[] = {
+    {32, true, 120, 190},  {44, false, 120, 190},
+    {100, true, 60, 180},  {105, false, 60, 180},
+};
+static const expected_event_t tap_render_events[] = {
+    {TOUCH_EV_DOWN, 120, 190}, {TOUCH_EV_UP, 120, 190},
+};
+
+// An ordinary 40 ms tap must not come out doubled
+static const sample_t tap_long[] = { {100, true, 180, 180}, {140, false, 180, 180} };
+static const expected_event_t tap_long_events[] = {
+    {TOUCH_EV_DOWN, 180, 180}, {TOUCH_EV_UP, 180, 180},
+};
+
+#define COUNT(a) (uint16_t)(sizeof(a) / sizeof(a[0]))
+#define TRACE(name, render, idle, samples, events, unseen) \
+    { name, render, idle, samples, COUNT(samples), events, COUNT(events), unseen }
+
+static const trace_t traces[] = {
+    TRACE("tap_5ms_idle",   4,  16, tap_idle,   tap_idle_events,   0),
+    TRACE("tap_5ms_render", 30, 16, tap_render, tap_render_events, 1),
+    TRACE("tap_40ms",       4,  16, tap_long,   tap_long_events,   0),
+};
+
+//----------------------- Replay ------------------------
+
+static const char *type_name(uint8_t type)
+{
+    return type == TOUCH_EV_DOWN ? "DOWN" : (type == TOUCH_EV_MOVE ? "MOVE" : "UP");
+}
+
+static bool replay(const trace_t *trace)
+{
+    chsc6x_fake.clear();
+    for (uint16_t i = 0; i < trace->sample_count; i++) {
+        const sample_t *s = &trace->samples[i];
+        chsc6x_fake.add(s->ms, s->down, s->x, s->y);
+    }
+    touch_events_begin();
+
+    uint32_t origin = millis();
+    chsc6x_fake.follow(origin);
+
+    std::string got;
+    uint16_t    matched = 0;
+    bool        same    = true;
+    uint32_t    end_ms  = chsc6x_fake.duration() + TOUCH_RELEASE_MS + 2 * CHSC6X_FAKE_REPORT_MS;
+
+    while (millis() - origin <= end_ms) {
+        touch_events_update();
+
+        const touch_event_t *events;
+        uint8_t count = touch_frame_events(&events);
+        for (uint8_t i = 0; i < count; i++) {
+            const touch_event_t *ev = &events[i];
+            char text[32];
+            snprintf(text, sizeof(text), " %s %d,%d", type_name(ev->type), ev->x, ev->y);
+            got += text;
+
+            const expected_event_t *want = matched < trace->event_count ? &trace->events[matched] : NULL;
+            same &= want && want->type == ev->type && want->x == ev->x && want->y == ev->y;
+            matched++;
+        }
+
+        // Render: the clock runs and reports come in, nobody reads them
+        host_clock::advance(std::chrono::milliseconds(trace->render_ms));
+        chsc6x_fake.run_until(millis() - origin);
+
+        touch_events_wait(trace->idle_ms);
+    }
+
+    uint32_t unseen = touch_events_stats()->unseen;
+    same &= matched == trace->event_count && unseen == trace->unseen;
+    printf("%-15s%s, unseen %lu: %s\n", trace->name, got.c_str(), (unsigned long)unseen,
+           same ? "ok" : "FAILED");
+    return same;
+}
+
+int main(void)
+{
+    host_clock::set_stepped(true);
+
+    uint8_t failed = 0;
+    for (const trace_t &trace : traces) {
+        failed += !replay(&trace);
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,229 @@
+// Replays touch traces through the gesture recogniser (touch_gesture.cpp)
+// and checks which gestures come out, with the detection latency.
+//
+//   touch_gesture_check
+//
+// The traces are synthetic: hand-written reports every 10 ms in the shape of
+// the dino's gestures, not recordings. The tracker is set up like the
+// dino's (start box 100..140, 20 px swipes) and ticked every
+// TRACE_STEP_MS, the loop() period.
+//
+// Exits 1 if any trace gives different gestures.
+#include <Arduino.h>
+
+// touch_gesture_update() pulls in touch_events.cpp, which reads the controller
+#define CHSC6X_FAKE_IMPLEMENTATION
+#include "chsc6x_fake.h"
+#include "touch_gesture.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#define TRACE_STEP_MS 16   // simulated loop() period
+
+// touch_events_begin() hooks these in the display driver; there is none here
+lv_indev_t *lv_xiao_touch_indev(void)
+{
+    return NULL;
+}
+
+void lv_xiao_disp_set_poll_cb(void (*cb)(void))
+{
+    (void)cb;
+}
+
+//----------------------- Traces ------------------------
+
+// One controller report; same columns as touch_events_trace() / chsc6x_fake.h
+typedef struct {
+    uint32_t ms;
+    bool     down;
+    int16_t  x, y;
+} sample_t;
+
+typedef struct {
+    const char     *name;
+    const sample_t *samples;
+    uint16_t        count;
+    uint8_t         expected[4];   // gestures other than DRAG, in order, NONE-terminated
+    uint8_t         expected_dir;  // for swipes
+} trace_t;
+
+static const sample_t TRACE_TAP[] = {
+    {0, true, 120, 118}, {10, true, 121, 118}, {20, true, 121, 119}, {70, false, 121, 119},
+};
+
+static const sample_t TRACE_DOUBLE_TAP[] = {
+    {0, true, 118, 122}, {10, true, 118, 122}, {60, false, 118, 122},
+    {170, true, 120, 121}, {180, true, 120, 121}, {230, false, 120, 121},
+};
+
+static const sample_t TRACE_LONG_PRESS[] = {
+    {0, true, 125, 115},   {10, true, 126, 115},  {100, true, 126, 116}, {300, true, 127, 116},
+    {500, true, 127, 117}, {700, true, 127, 117}, {800, false, 127, 117},
+};
+
+static const sample_t TRACE_SWIPE_LEFT[] = {
+    {0, true, 130, 120}, {10, true, 124, 120}, {20, true, 114, 121}, {30, true, 100, 121},
+    {40, true, 86, 122}, {50, true, 72, 122},  {60, true, 60, 123},  {70, false, 60, 123},
+};
+
+static const sample_t TRACE_SWIPE_UP[] = {
+    {0, true, 120, 138}, {10, true, 120, 130}, {20, true, 121, 118}, {30, true, 121, 104},
+    {40, true, 122, 90}, {50, true, 122, 78},  {60, false, 122, 78},
+};
+
+// Slow drag that stops before lifting: not a swipe
+static const sample_t TRACE_SLOW_DRAG[] = {
+    {0, true, 110, 120},   {50, true, 114, 120},  {100, true, 118, 120}, {150, true, 122, 120},
+    {200, true, 126, 120}, {250, true, 130, 120}, {300, true, 134, 120}, {400, true, 134, 120},
+    {500, false, 134, 120},
+};
+
+// Tap followed by a swipe: the tap must still be reported
+static const sample_t TRACE_TAP_THEN_SWIPE[] = {
+    {0, true, 120, 120},  {40, false, 120, 120},
+    {150, true, 110, 120}, {160, true, 120, 120}, {170, true, 134, 121}, {180, true, 150, 121},
+    {190, true, 166, 122}, {200, false, 166, 122},
+};
+
+// Press that starts outside the start box: ignored
+static const sample_t TRACE_OUTSIDE[] = {
+    {0, true, 40, 40}, {10, true, 60, 40}, {20, true, 90, 40}, {30, false, 90, 40},
+};
+
+// Glitched report in the middle of a right swipe
+static const sample_t TRACE_SWIPE_GLITCH[] = {
+    {0, true, 105, 120}, {10, true, 112, 120}, {20, true, 124, 121}, {30, true, 230, 0},
+    {40, true, 140, 121}, {50, true, 156, 122}, {60, true, 170, 122}, {70, false, 170, 122},
+};
+
+// Fast right swipe with reports lost in between: the jump from 124 to 210 is
+// real, the next report confirms it and the swipe has to carry on from there
+static const sample_t TRACE_SWIPE_JUMP[] = {
+    {0, true, 105, 120}, {10, true, 112, 120}, {20, true, 124, 121}, {30, true, 210, 122},
+    {40, true, 222, 122}, {50, true, 234, 123}, {60, false, 234, 123},
+};
+
+#define TRACE(samples) samples, (uint16_t)(sizeof(samples) / sizeof(samples[0]))
+
+static const trace_t traces[] = {
+    {"tap",            TRACE(TRACE_TAP),            {TOUCH_GESTURE_TAP}, 0},
+    {"double-tap",     TRACE(TRACE_DOUBLE_TAP),     {TOUCH_GESTURE_DOUBLE_TAP}, 0},
+    {"long-press",     TRACE(TRACE_LONG_PRESS),     {TOUCH_GESTURE_LONG_PRESS}, 0},
+    {"swipe-left",     TRACE(TRACE_SWIPE_LEFT),     {TOUCH_GESTURE_SWIPE}, SWIPE_DIR_LEFT},
+    {"swipe-up",       TRACE(TRACE_SWIPE_UP),       {TOUCH_GESTURE_SWIPE}, SWIPE_DIR_UP},
+    {"slow-drag",      TRACE(TRACE_SLOW_DRAG),      {TOUCH_GESTURE_DRAG_END}, 0},
+    {"tap-then-swipe", TRACE(TRACE_TAP_THEN_SWIPE), {TOUCH_GESTURE_TAP, TOUCH_GESTURE_SWIPE}, SWIPE_DIR_RIGHT},
+    {"outside",        TRACE(TRACE_OUTSIDE),        {TOUCH_GESTURE_NONE}, 0},
+    {"swipe-glitch",   TRACE(TRACE_SWIPE_GLITCH),   {TOUCH_GESTURE_SWIPE}, SWIPE_DIR_RIGHT},
+    {"swipe-jump",     TRACE(TRACE_SWIPE_JUMP),     {TOUCH_GESTURE_SWIPE}, SWIPE_DIR_RIGHT},
+};
+
+//----------------------- Replay ------------------------
+
+// Turns the next sample into the event touch_events_service() would queue
+static bool sample_event(const sample_t *s, bool *down, touch_event_t *ev)
+{
+    ev->ms = s->ms;
+    ev->x  = s->x;
+    ev->y  = s->y;
+    if (s->down) {
+        ev->type = *down ? TOUCH_EV_MOVE : TOUCH_EV_DOWN;
+    } else if (*down) {
+        ev->type = TOUCH_EV_UP;
+    } else {
+        return false;
+    }
+    *down = s->down;
+    return true;
+}
+
+// Gestures recognised during one trace, DRAGs left out
+typedef struct {
+    uint8_t  types[4];
+    uint8_t  count;
+    uint8_t  dir;
+    uint32_t latency_ms;   // from the sample that completed the last gesture to its report
+} result_t;
+
+static void collect(const touch_gesture_tracker_t *tracker, result_t *result)
+{
+    for (uint8_t i = 0; i < tracker->out_count; i++) {
+        const touch_gesture_t *g = &tracker->out[i];
+        if (g->type == TOUCH_GESTURE_DRAG || result->count >= 4) {
+            continue;
+        }
+        result->types[result->count++] = g->type;
+        result->latency_ms = g->emitted_ms - g->ms;
+        if (g->type == TOUCH_GESTURE_SWIPE) {
+            result->dir = g->dir;
+        }
+    }
+}
+
+static uint8_t expected_count(const trace_t *trace)
+{
+    uint8_t n = 0;
+    while (n < 4 && trace->expected[n] != TOUCH_GESTURE_NONE) {
+        n++;
+    }
+    return n;
+}
+
+static std::string type_names(const uint8_t *types, uint8_t count)
+{
+    std::string text = count ? "" : "none";
+    for (uint8_t i = 0; i < count; i++) {
+        text += i ? "+" : "";
+        text += touch_gesture_name(types[i]);
+    }
+    return text;
+}
+
+static bool replay(const trace_t *trace)
+{
+    touch_gesture_tracker_t tracker;
+    touch_gesture_init(&tracker, 100, 140, 100, 140, 20);
+
+    result_t result;
+    memset(&result, 0, sizeof(result));
+
+    bool     down = false;
+    uint16_t next = 0;
+    uint32_t end  = trace->samples[trace->count - 1].ms + 1000;   // let timeouts expire
+
+    for (uint32_t now = 0; now <= end; now += TRACE_STEP_MS) {
+        tracker.out_count = 0;
+        while (next < trace->count && trace->samples[next].ms <= now) {
+            touch_event_t ev;
+            if (sample_event(&trace->samples[next++], &down, &ev)) {
+                touch_gesture_feed(&tracker, &ev, now);
+            }
+        }
+        touch_gesture_tick(&tracker, now);
+        collect(&tracker, &result);
+    }
+
+    uint8_t expected = expected_count(trace);
+    bool    same     = result.count == expected &&
+                       memcmp(result.types, trace->expected, expected) == 0 &&
+                       (trace->expected_dir == SWIPE_DIR_NONE || result.dir == trace->expected_dir);
+
+    printf("%-15s expected %-15s got %-15s latency %3lu ms: %s\n", trace->name,
+           type_names(trace->expected, expected).c_str(),
+           type_names(result.types, result.count).c_str(),
+           (unsigned long)result.latency_ms, same ? "ok" : "FAILED");
+    return same;
+}
+
+int main(void)
+{
+    uint8_t failed = 0;
+    for (const trace_t &trace : traces) {
+        failed += !replay(&trace);
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,131 @@
+// The Q15 sine table against sinf(), and the sprite exec callbacks' layer
+// offsets (anim_offsets.h) against the float expressions they replaced.
+//
+//   trig_bench [--ticks N]
+//
+//   --ticks N  animation ticks timed for each version (default 3600, one
+//              per decidegree of a full turn)
+//
+// Prints the worst Q15 error, how many layer offsets land a pixel away from
+// the float version and the cost per tick of a dino-sized stack both ways.
+// The pet pivot bob and item rise are compared per (angle, layer), out of
+// 'samples'; the pet rise has no angle and is compared once per layer.
+//
+// Angle-dependent offsets may land a pixel off where the float version sat
+// right on a boundary; those are only counted. Exits 1 if the table is off by
+// more than one Q15 step or a rise that has no angle differs.
+#include "anim_offsets.h"
+#include "trig_lut.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#define TRIG_BENCH_LAYERS 15          // a dino-sized stack
+
+//----------------------- Float reference ------------------------
+
+// What pet_anim / item_anim / rotate_anim computed before the lookup table
+static int32_t pet_pivot_float(uint16_t sprite_index, int32_t v)
+{
+    return sinf((v / 3600.0) * M_PI * 2) * sprite_index / 4;
+}
+
+// base_y fixed at 120, the screen centre, so truncation matches a real layer
+static int16_t pet_y_float(uint16_t sprite_index)
+{
+    float layer_multiplier = 1.0 + (sprite_index * 1.2);
+    return 120 - (layer_multiplier * 2);
+}
+
+static int16_t item_rise_float(uint16_t sprite_index, int32_t v)
+{
+    int32_t wrapped_v = v % 3600;
+    float angle_f = wrapped_v / 3600.0f;
+    float entire_stack_offset = (sinf(angle_f * 2.0f * M_PI) + 1.0f) * 0.5f * 10.0f;
+    float wave = sinf(angle_f * M_PI);
+    float layer_offset = 2.0f * sprite_index + (wave * 3.0f * sprite_index);
+    return (int16_t)entire_stack_offset + (int16_t)layer_offset;
+}
+
+static int16_t rotate_y_float(uint16_t sprite_index)
+{
+    float baseline_offset = 1.0f;
+    return 120 - baseline_offset * sprite_index;
+}
+
+//----------------------- Bench ------------------------
+
+static double elapsed_us(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+static volatile int32_t sink;
+
+int main(int argc, char **argv)
+{
+    uint32_t ticks = TRIG_TURN;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "--ticks") && i + 1 < argc) {
+            ticks = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else {
+            fprintf(stderr, "usage: %s [--ticks N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (ticks == 0) {
+        ticks = 1;
+    }
+
+    // 1) Raw accuracy over one turn
+    int32_t max_err = 0;
+    for (int32_t a = 0; a < TRIG_TURN; a++) {
+        int32_t ref = (int32_t)lroundf(sinf(a * (float)M_PI / 1800.0f) * TRIG_Q15_ONE);
+        int32_t err = abs(trig_sin_q15(a) - ref);
+        if (err > max_err) {
+            max_err = err;
+        }
+    }
+
+    // 2) Layer offsets that land on a different pixel: pivot and item rise
+    //    per (angle, layer), the pet and rotate rises once per layer
+    uint32_t pivot_diff = 0, item_diff = 0, rise_diff = 0;
+    for (int32_t v = 0; v < TRIG_TURN; v++) {
+        for (uint16_t i = 0; i < TRIG_BENCH_LAYERS; i++) {
+            pivot_diff += pet_pivot_float(i, v) != pet_pivot_offset(i, v);
+            item_diff  += item_rise_float(i, v) != item_layer_rise(i, v);
+        }
+    }
+    for (uint16_t i = 0; i < TRIG_BENCH_LAYERS; i++) {
+        rise_diff += pet_y_float(i) != 120 - pet_layer_rise(i);
+        rise_diff += rotate_y_float(i) != 120 - rotate_layer_rise(i);
+    }
+
+    // 3) Cost per tick of a whole stack, pet + item offsets for every layer
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < ticks; t++) {
+        for (uint16_t i = 0; i < TRIG_BENCH_LAYERS; i++) {
+            sink = sink + pet_pivot_float(i, t) + pet_y_float(i) + item_rise_float(i, t);
+        }
+    }
+    double float_us = elapsed_us(start);
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t t = 0; t < ticks; t++) {
+        for (uint16_t i = 0; i < TRIG_BENCH_LAYERS; i++) {
+            sink = sink + pet_pivot_offset(i, t) + (120 - pet_layer_rise(i)) + item_layer_rise(i, t);
+        }
+    }
+    double lut_us = elapsed_us(start);
+
+    printf("%-12s %9s %9s %8s %9s %7s %13s %11s\n", "max_q15_err", "pivot_px", "item_px",
+           "samples", "rise_px", "layers", "float us/tick", "lut us/tick");
+    printf("%-12d %9u %9u %8u %9u %7u %13.3f %11.3f\n", max_err, pivot_diff, item_diff,
+           (unsigned)TRIG_TURN * TRIG_BENCH_LAYERS, rise_diff, 2 * TRIG_BENCH_LAYERS,
+           float_us / ticks, lut_us / ticks);
+    return max_err > 1 || rise_diff ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+#include "imu_fifo.h"
+#include "mem_plan.h"
+
+static LSM6DS3          *fifo_imu = NULL;
+static imu_fifo_stats_t  stats;
+
+// Preallocated ring of decoded-but-unscaled frames
+static imu_frame_t *const ring = (imu_frame_t *)MEM_ARENA(MEM_ARENA_IMU_RING);
+static uint16_t    ring_head = 0;   // next slot to write
+static uint16_t    ring_tail = 0;   // next slot to read
+
+//----------------------- Ring buffer ------------------------
+
+static void ring_push(const imu_frame_t *frame)
+{
+    if ((uint16_t)(ring_head - ring_tail) >= IMU_RING_FRAMES) {
+        // Full: keep the newest data, the oldest frame is the one that goes
+        ring_tail++;
+        stats.dropped++;
+    }
+    ring[ring_head & (IMU_RING_FRAMES - 1)] = *frame;
+    ring_head++;
+}
+
+uint16_t imu_ring_count(void)
+{
+    return (uint16_t)(ring_head - ring_tail);
+}
+
+bool imu_ring_pop(imu_frame_t *frame)
+{
+    if (ring_head == ring_tail) {
+        return false;
+    }
+    *frame = ring[ring_tail & (IMU_RING_FRAMES - 1)];
+    ring_tail++;
+    return true;
+}
+
+void imu_ring_clear(void)
+{
+    ring_tail = ring_head;
+}
+
+//----------------------- Register helpers ------------------------
+
+static void set_odr(uint8_t reg)
+{
+    uint8_t value = 0;
+    fifo_imu->readRegister(&value, reg);
+    value = (value & 0x0F) | (IMU_ODR_BITS << 4);  // keep full scale + bandwidth
+    fifo_imu->writeRegister(reg, value);
+}
+
+static inline int16_t word_at(const uint8_t *bytes, uint8_t index)
+{
+    return (int16_t)(bytes[index * 2] | (bytes[index * 2 + 1] << 8));
+}
+
+//----------------------- FIFO control ------------------------
+
+bool imu_fifo_begin(LSM6DS3 *imu)
+{
+    fifo_imu = imu;
+    memset(&stats, 0, sizeof(stats));
+    ring_head = ring_tail = 0;
+
+    set_odr(IMU_REG_CTRL1_XL);
+    set_odr(IMU_REG_CTRL2_G);
+
+    // No watermark, both sensors in the FIFO without decimation
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL1, 0x00);
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL2, 0x00);
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL3, (0x1 << 3) | 0x1);
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL4, 0x00);
+
+    imu_fifo_reset();
+    return true;
+}
+
+void imu_fifo_end(void)
+{
+    if (!fifo_imu) {
+        return;
+    }
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL5, 0x00);  // bypass
+    imu_ring_clear();
+}
+
+void imu_fifo_reset(void)
+{
+    if (!fifo_imu) {
+        return;
+    }
+    // Going through bypass mode empties the hardware FIFO
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL5, 0x00);
+    fifo_imu->writeRegister(IMU_REG_FIFO_CTRL5, (IMU_ODR_BITS << 3) | 0x6);  // continuous
+    imu_ring_clear();
+}
+
+uint16_t imu_fifo_drain(void)
+{
+    if (!fifo_imu) {
+        return 0;
+    }
+
+    // STATUS1..4 in one transfer: unread word count, flags and pattern
+    uint8_t status[4];
+    fifo_imu->readRegisterRegion(status, IMU_REG_FIFO_STATUS1, sizeof(status));
+
+    if (status[1] & IMU_FIFO_STATUS2_OVER_RUN) {
+        stats.overruns++;
+    }
+    if (status[1] & IMU_FIFO_STATUS2_EMPTY) {
+        return 0;
+    }
+
+    uint16_t words   = ((status[1] & 0x0F) << 8) | status[0];
+    uint16_t pattern = ((status[3] & 0x03) << 8) | status[2];
+
+    // Realign on a frame boundary (pattern 0 = next word is Gx)
+    uint8_t scratch[IMU_FIFO_BURST_FRAMES * IMU_FIFO_WORDS_PER_FRAME * 2];
+    if (pattern != 0) {
+        uint16_t skip = IMU_FIFO_WORDS_PER_FRAME - pattern;
+        if (skip > words) {
+            return 0;
+        }
+        fifo_imu->readRegisterRegion(scratch, IMU_REG_FIFO_DATA_OUT_L, skip * 2);
+        words -= skip;
+    }
+
+    uint16_t frames = words / IMU_FIFO_WORDS_PER_FRAME;
+    if (frames > IMU_RING_FRAMES) {
+        frames = IMU_RING_FRAMES;
+    }
+
+    // The address pointer wraps from DATA_OUT_H back to DATA_OUT_L, so a
+    // single burst returns consecutive FIFO words
+    uint16_t done = 0;
+    while (done < frames) {
+        uint8_t batch = (frames - done) < IMU_FIFO_BURST_FRAMES ? (frames - done) : IMU_FIFO_BURST_FRAMES;
+        fifo_imu->readRegisterRegion(scratch, IMU_REG_FIFO_DATA_OUT_L,
+                                     batch * IMU_FIFO_WORDS_PER_FRAME * 2);
+        stats.bursts++;
+
+        for (uint8_t i = 0; i < batch; i++) {
+            const uint8_t *bytes = &scratch[i * IMU_FIFO_WORDS_PER_FRAME * 2];
+            imu_frame_t frame;
+            frame.gx = word_at(bytes, 0);
+            frame.gy = word_at(bytes, 1);
+            frame.gz = word_at(bytes, 2);
+            frame.ax = word_at(bytes, 3);
+            frame.ay = word_at(bytes, 4);
+            frame.az = word_at(bytes, 5);
+            ring_push(&frame);
+        }
+        done += batch;
+    }
+
+    stats.frames_read += frames;
+    return frames;
+}
+
+const imu_fifo_stats_t *imu_fifo_stats(void)
+{
+    return &stats;
+}
+
+void imu_frame_to_float(const imu_frame_t *frame, float out[6])
+{
+    out[0] = fifo_imu->calcAccel(frame->ax);
+    out[1] = fifo_imu->calcAccel(frame->ay);
+    out[2] = fifo_imu->calcAccel(frame->az);
+    out[3] = fifo_imu->calcGyro(frame->gx);
+    out[4] = fifo_imu->calcGyro(frame->gy);
+    out[5] = fifo_imu->calcGyro(frame->gz);
+}
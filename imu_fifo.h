@@ -0,0 +1,72 @@
+#ifndef IMU_FIFO_H
+#define IMU_FIFO_H
+
+#include <Arduino.h>
+#include <LSM6DS3.h>
+
+// LSM6DS3 registers used by the FIFO reader
+#define IMU_REG_FIFO_CTRL1      0x06   // watermark [7:0]
+#define IMU_REG_FIFO_CTRL2      0x07   // watermark [11:8]
+#define IMU_REG_FIFO_CTRL3      0x08   // gyro / accel decimation
+#define IMU_REG_FIFO_CTRL4      0x09
+#define IMU_REG_FIFO_CTRL5      0x0A   // FIFO ODR + mode
+#define IMU_REG_CTRL1_XL        0x10
+#define IMU_REG_CTRL2_G         0x11
+#define IMU_REG_FIFO_STATUS1    0x3A   // unread words [7:0]
+#define IMU_REG_FIFO_STATUS2    0x3B   // flags + unread words [11:8]
+#define IMU_REG_FIFO_STATUS3    0x3C   // pattern [7:0]
+#define IMU_REG_FIFO_STATUS4    0x3D   // pattern [9:8]
+#define IMU_REG_FIFO_DATA_OUT_L 0x3E
+
+#define IMU_FIFO_STATUS2_OVER_RUN 0x40
+#define IMU_FIFO_STATUS2_EMPTY    0x10
+
+// Acquisition settings
+#define IMU_ODR_HZ              104    // accel, gyro and FIFO all run at this rate
+#define IMU_ODR_BITS            0x4    // 104 Hz in the ODR_XL / ODR_G / ODR_FIFO fields
+#define IMU_FIFO_WORDS_PER_FRAME 6     // Gx Gy Gz Ax Ay Az
+#define IMU_FIFO_BURST_FRAMES   2      // 24 bytes per transfer, fits the 32 byte Wire buffer
+#define IMU_RING_FRAMES         256    // must be a power of two
+
+typedef struct {
+    int16_t ax, ay, az;   // raw accel counts
+    int16_t gx, gy, gz;   // raw gyro counts
+} imu_frame_t;
+
+typedef struct {
+    uint32_t frames_read;  // frames moved from the FIFO into the ring
+    uint32_t bursts;       // I2C burst transfers issued
+    uint32_t overruns;     // times the hardware FIFO overflowed between drains
+    uint32_t dropped;      // frames lost because the ring was full
+} imu_fifo_stats_t;
+
+/**
+ * @brief Puts accel + gyro at IMU_ODR_HZ and starts the FIFO in continuous mode.
+ *        Call after imu->begin(); the library's range settings are kept.
+ */
+bool imu_fifo_begin(LSM6DS3 *imu);
+
+// Stops the FIFO (bypass mode) and empties the ring
+void imu_fifo_end(void);
+
+// Discards everything queued in the hardware FIFO and in the ring
+void imu_fifo_reset(void);
+
+/**
+ * @brief Moves every complete frame queued in the hardware FIFO into the ring
+ *        using burst reads. Cheap to call often; does nothing when empty.
+ *
+ * @return number of frames added to the ring
+ */
+uint16_t imu_fifo_drain(void);
+
+uint16_t imu_ring_count(void);
+bool     imu_ring_pop(imu_frame_t *frame);
+void     imu_ring_clear(void);
+
+const imu_fifo_stats_t *imu_fifo_stats(void);
+
+// Decodes a raw frame with the IMU's configured ranges (g and deg/s)
+void imu_frame_to_float(const imu_frame_t *frame, float out[6]);
+
+#endif // IMU_FIFO_H
@@ -0,0 +1,176 @@
+#include "imu_quant.h"
+
+static LSM6DS3           *quant_imu = NULL;
+static imu_quant_table_t  table;
+
+// Same normalisation the model was trained with (see the notebook)
+static const float ACCEL_OFFSET = 4.0f,    ACCEL_SPAN = 8.0f;
+static const float GYRO_OFFSET  = 2000.0f, GYRO_SPAN  = 4000.0f;
+
+static inline uint32_t bucket_of(int32_t raw)
+{
+    return (uint32_t)(raw - INT16_MIN) >> IMU_QUANT_BUCKET_SHIFT;
+}
+
+// Highest level whose first count is <= raw. The bucket's start level is at
+// most that, and the walk up the steps stops at 127, so it also saturates.
+// With the notebook's scales a bucket crosses at most two level boundaries
+// (the 16 g accelerometer range: ~64 counts a level); those two steps are
+// taken without branching, the loop only runs for finer input scales.
+static inline int8_t quantize_axis(int16_t raw, const int8_t *start, const int32_t *steps)
+{
+    int32_t q = start[bucket_of(raw)];
+    q += (q < 127) & (raw >= steps[q + 1]);
+    q += (q < 127) & (raw >= steps[q + 1]);
+    while (q < 127 && raw >= steps[q + 1]) {
+        q++;
+    }
+    return (int8_t)q;
+}
+
+//----------------------- Reference path ------------------------
+
+// Float path as the capture loop used to do it, per axis
+static int8_t reference_axis(float value, float offset, float span)
+{
+    float q = roundf(((value + offset) / span) / gesture_engine_input_scale()
+                     + gesture_engine_input_zero_point());
+    if (q >  127.0f) return  127;
+    if (q < -128.0f) return -128;
+    return (int8_t)q;
+}
+
+static int8_t reference_raw(bool is_accel, int32_t raw)
+{
+    return is_accel ? reference_axis(quant_imu->calcAccel(raw), ACCEL_OFFSET, ACCEL_SPAN)
+                    : reference_axis(quant_imu->calcGyro(raw),  GYRO_OFFSET,  GYRO_SPAN);
+}
+
+// steps[q] = smallest raw count the float path maps to q or above. The float
+// path is monotonic, so a binary search per level finds it.
+static void build_steps(bool is_accel, int32_t *steps)
+{
+    steps[-128] = INT16_MIN;
+    for (int32_t q = -127; q <= 128; q++) {
+        int32_t lo = INT16_MIN, hi = (int32_t)INT16_MAX + 1;
+        while (lo < hi) {
+            int32_t mid = lo + (hi - lo) / 2;
+            if (reference_raw(is_accel, mid) >= q) {
+                hi = mid;
+            } else {
+                lo = mid + 1;
+            }
+        }
+        steps[q] = lo;   // INT16_MAX + 1 when the level is never reached
+    }
+}
+
+static void build_starts(const int32_t *steps, int8_t *start)
+{
+    int32_t q = -128;
+    for (uint32_t b = 0; b < (65536 >> IMU_QUANT_BUCKET_SHIFT); b++) {
+        int32_t first = INT16_MIN + (int32_t)(b << IMU_QUANT_BUCKET_SHIFT);
+        while (q < 127 && first >= steps[q + 1]) {
+            q++;
+        }
+        start[b] = (int8_t)q;
+    }
+}
+
+void imu_quant_init(LSM6DS3 *imu)
+{
+    quant_imu = imu;
+
+    build_steps(true,  &table.accel_steps[128]);
+    build_steps(false, &table.gyro_steps[128]);
+    build_starts(&table.accel_steps[128], table.accel_start);
+    build_starts(&table.gyro_steps[128],  table.gyro_start);
+}
+
+const imu_quant_table_t *imu_quant_table(void)
+{
+    return &table;
+}
+
+void imu_quant_frame(const imu_frame_t *frame, int8_t *out)
+{
+    const int32_t *accel = &table.accel_steps[128];
+    const int32_t *gyro  = &table.gyro_steps[128];
+    out[0] = quantize_axis(frame->ax, table.accel_start, accel);
+    out[1] = quantize_axis(frame->ay, table.accel_start, accel);
+    out[2] = quantize_axis(frame->az, table.accel_start, accel);
+    out[3] = quantize_axis(frame->gx, table.gyro_start,  gyro);
+    out[4] = quantize_axis(frame->gy, table.gyro_start,  gyro);
+    out[5] = quantize_axis(frame->gz, table.gyro_start,  gyro);
+}
+
+//----------------------- Checks ------------------------
+
+void imu_quant_frame_reference(const imu_frame_t *frame, int8_t *out)
+{
+    float values[6];
+    imu_frame_to_float(frame, values);
+
+    out[0] = reference_axis(values[0], ACCEL_OFFSET, ACCEL_SPAN);
+    out[1] = reference_axis(values[1], ACCEL_OFFSET, ACCEL_SPAN);
+    out[2] = reference_axis(values[2], ACCEL_OFFSET, ACCEL_SPAN);
+    out[3] = reference_axis(values[3], GYRO_OFFSET,  GYRO_SPAN);
+    out[4] = reference_axis(values[4], GYRO_OFFSET,  GYRO_SPAN);
+    out[5] = reference_axis(values[5], GYRO_OFFSET,  GYRO_SPAN);
+}
+
+uint32_t imu_quant_verify(void)
+{
+    uint32_t mismatches = 0;
+
+    // Every raw value lands on every axis once, so any recording is covered
+    for (int32_t raw = INT16_MIN; raw <= INT16_MAX; raw++) {
+        imu_frame_t frame;
+        frame.ax = frame.ay = frame.az = (int16_t)raw;
+        frame.gx = frame.gy = frame.gz = (int16_t)raw;
+
+        int8_t fixed[GESTURE_NUM_AXES], reference[GESTURE_NUM_AXES];
+        imu_quant_frame(&frame, fixed);
+        imu_quant_frame_reference(&frame, reference);
+
+        for (int axis = 0; axis < GESTURE_NUM_AXES; axis++) {
+            mismatches += (fixed[axis] != reference[axis]);
+        }
+    }
+    return mismatches;
+}
+
+void imu_quant_benchmark(const imu_frame_t *data, uint16_t count, uint32_t frames)
+{
+    int8_t            out[GESTURE_NUM_AXES];
+    volatile uint32_t sink = 0;   // keeps the loops from being optimised away
+
+    uint32_t start = micros();
+    for (uint32_t i = 0; i < frames; i++) {
+        imu_quant_frame_reference(&data[i % count], out);
+        sink += (uint8_t)out[i % GESTURE_NUM_AXES];
+    }
+    uint32_t float_us = micros() - start;
+
+    start = micros();
+    for (uint32_t i = 0; i < frames; i++) {
+        imu_quant_frame(&data[i % count], out);
+        sink += (uint8_t)out[i % GESTURE_NUM_AXES];
+    }
+    uint32_t fixed_us = micros() - start;
+
+    uint32_t mismatches = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        int8_t fixed[GESTURE_NUM_AXES], reference[GESTURE_NUM_AXES];
+        imu_quant_frame(&data[i], fixed);
+        imu_quant_frame_reference(&data[i], reference);
+        mismatches += memcmp(fixed, reference, sizeof(fixed)) != 0;
+    }
+
+    Serial.print("imu_quant float ns/frame: ");
+    Serial.print(float_us * 1000.0f / frames, 1);
+    Serial.print(" fixed ns/frame: ");
+    Serial.print(fixed_us * 1000.0f / frames, 1);
+    Serial.print(" mismatched frames: ");
+    Serial.println(mismatches);
+}
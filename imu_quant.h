@@ -0,0 +1,56 @@
+#ifndef IMU_QUANT_H
+#define IMU_QUANT_H
+
+#include <Arduino.h>
+#include <LSM6DS3.h>
+#include "imu_fifo.h"
+#include "gesture_engine.h"
+
+#define IMU_QUANT_BUCKET_SHIFT 7   // raw counts per bucket = 1 << shift
+
+typedef struct {
+    // First raw count of every int8 level (index q + 128, q = -128..128) in
+    // the float path. The kernel only compares against these, so it is
+    // bit-exact with the float path by construction.
+    int32_t accel_steps[257];
+    int32_t gyro_steps[257];
+
+    // Level of the first count of every bucket of 128 raw counts; where the
+    // kernel starts walking up the steps
+    int8_t  accel_start[65536 >> IMU_QUANT_BUCKET_SHIFT];
+    int8_t  gyro_start[65536 >> IMU_QUANT_BUCKET_SHIFT];
+} imu_quant_table_t;
+
+/**
+ * @brief Runs count->unit conversion, the notebook's normalisation and the
+ *        input tensor's scale / zero point (from the gesture engine) through
+ *        the float path once per level boundary and keeps the boundaries as
+ *        step tables. Call once after gesture_engine_init() and imu_fifo_begin().
+ */
+void imu_quant_init(LSM6DS3 *imu);
+
+const imu_quant_table_t *imu_quant_table(void);
+
+/**
+ * @brief Normalises and quantises one raw frame straight from int16 counts
+ *        into GESTURE_NUM_AXES int8 values (aX aY aZ gX gY gZ), saturating.
+ */
+void imu_quant_frame(const imu_frame_t *frame, int8_t *out);
+
+// Float path as the capture loop used to do it, kept as the reference
+void imu_quant_frame_reference(const imu_frame_t *frame, int8_t *out);
+
+/**
+ * @brief Runs every int16 value through both paths on all six axes.
+ *
+ * @return number of (axis, value) pairs where they disagree, 0 = bit-exact
+ */
+uint32_t imu_quant_verify(void);
+
+/**
+ * @brief Times both paths over 'frames' frames of recorded data and prints
+ *        ns/frame for each over Serial.
+ */
+void imu_quant_benchmark(const imu_frame_t *data, uint16_t count, uint32_t frames);
+
+#endif // IMU_QUANT_H
@@ -0,0 +1,45 @@
+#ifndef LOG_EVENTS_H
+#define LOG_EVENTS_H
+
+/*
+  Every event the log can record: id, then the text it decodes to. Arguments
+  are int32 and fill the %ld fields in order (at most 3). Shared with
+  host/log_decode.cpp, so keep it free of Arduino includes; append new events
+  at the end so old dumps still decode.
+*/
+#define LOG_EVENTS(X) \
+    X(LOG_EV_DROPPED,          "%ld log records dropped, ring full") \
+    X(LOG_EV_SWIPE,            "swipe dir=%ld vx=%ld vy=%ld px/s") \
+    X(LOG_EV_TOUCH,            "touch ev=%ld at (%ld,%ld)") \
+    X(LOG_EV_GESTURE,          "gesture class=%ld score=%ld/1000 took %ld us") \
+    X(LOG_EV_GESTURE_SCORE,    "  class %ld score=%ld/1000") \
+    X(LOG_EV_GESTURE_FAILED,   "gesture inference failed") \
+    X(LOG_EV_INVOKE_FAILED,    "Invoke failed") \
+    X(LOG_EV_CAPTURE_ARMED,    "capture armed, tracked heap %ld bytes live, peak %ld") \
+    X(LOG_EV_CAPTURE_TIMEOUT,  "gesture capture timed out waiting for motion") \
+    X(LOG_EV_ANIM_NO_DRIVER,   "stack not animated, all %ld stack animation drivers taken")
+
+#define LOG_EVENT_ENUM(id, fmt) id,
+typedef enum {
+    LOG_EVENTS(LOG_EVENT_ENUM)
+    LOG_EV_COUNT
+} log_event_id_t;
+#undef LOG_EVENT_ENUM
+
+// Levels, most severe first; the ERROR..DEBUG values are what a record stores
+#define LOG_LEVEL_NONE   (-1)
+#define LOG_LEVEL_ERROR  0
+#define LOG_LEVEL_WARN   1
+#define LOG_LEVEL_INFO   2
+#define LOG_LEVEL_DEBUG  3
+
+/*
+  Binary record, little endian:
+    0xA5 | id | argc (bits 0-1) + level (bits 2-3) | ms (4 bytes) | argc x int32
+*/
+#define LOG_RECORD_SYNC      0xA5
+#define LOG_RECORD_HEADER    7
+#define LOG_RECORD_MAX_ARGS  3
+#define LOG_RECORD_MAX       (LOG_RECORD_HEADER + 4 * LOG_RECORD_MAX_ARGS)
+
+#endif // LOG_EVENTS_H
@@ -0,0 +1,43 @@
+#include "mem_plan.h"
+
+static_assert(MEM_PLAN_TOTAL <= MEM_PLAN_BUDGET,
+              "memory plan exceeds MEM_PLAN_BUDGET; shrink an arena or raise the budget");
+
+uint8_t mem_plan_region[MEM_PLAN_TOTAL > 0 ? MEM_PLAN_TOTAL : 1] __attribute__((aligned(MEM_PLAN_ALIGN)));
+
+#define MEM_ARENA_NAME(id, name, bytes) name,
+static const char *arena_names[MEM_ARENA_COUNT] = { MEM_ARENAS(MEM_ARENA_NAME) };
+#undef MEM_ARENA_NAME
+
+const char *mem_arena_name(mem_arena_id_t id)
+{
+    return (id < MEM_ARENA_COUNT) ? arena_names[id] : "?";
+}
+
+extern "C" void *mem_plan_lvgl_pool(size_t size)
+{
+    if (size > MEM_ARENA_BYTES(MEM_ARENA_LVGL_POOL)) {
+        return NULL;
+    }
+    return MEM_ARENA(MEM_ARENA_LVGL_POOL);
+}
+
+void mem_plan_print(void)
+{
+    Serial.println("memory plan: arena,offset,bytes");
+    for (int i = 0; i < MEM_ARENA_COUNT; i++) {
+        Serial.print("  ");
+        Serial.print(arena_names[i]);
+        Serial.print(",");
+        Serial.print((unsigned long)mem_plan_offset(i));
+        Serial.print(",");
+        Serial.println((unsigned long)mem_arena_sizes[i]);
+    }
+    Serial.print("  total ");
+    Serial.print((unsigned long)MEM_PLAN_TOTAL);
+    Serial.print(" of ");
+    Serial.print((unsigned long)MEM_PLAN_BUDGET);
+    Serial.print(" B budget, ");
+    Serial.print((unsigned long)(MEM_PLAN_BUDGET - MEM_PLAN_TOTAL));
+    Serial.println(" B spare");
+}
@@ -0,0 +1,115 @@
+#ifndef MEM_PLAN_H
+#define MEM_PLAN_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "lv_xiao_round_screen.h"
+#include "gesture_engine.h"
+#include "imu_fifo.h"
+#include "sprite_cache.h"
+#include "sprite_rle.h"
+#include "stack_compositor.h"
+
+/*
+  One static region, carved at compile time into the arenas below. What the
+  sketch needs in steady state lives here, the composited stacks' buffers
+  included. The heap holds the hit registry, set up at boot, and the draw
+  buffers taller than LVGL_BUFF_SIZE that lv_xiao_disp_set_buffer_rows()
+  asks for; nothing else allocates while the sketch animates.
+
+  The build fails if the plan doesn't fit MEM_PLAN_BUDGET, which is what the
+  board can spare for it next to the stack, the heap and the libraries' own
+  .bss. Raise or lower it per board in the build flags.
+*/
+#ifndef MEM_PLAN_BUDGET
+#if defined(ESP32)
+#define MEM_PLAN_BUDGET (160UL * 1024)
+#elif defined(ARDUINO_ARCH_NRF52) || defined(ARDUINO_ARCH_MBED)
+#define MEM_PLAN_BUDGET (128UL * 1024)  // of 256 KB, the SoftDevice takes the first ~24 KB
+#else
+#define MEM_PLAN_BUDGET (1024UL * 1024)
+#endif
+#endif
+
+#define MEM_PLAN_ALIGN 16               // every arena starts on this boundary
+
+#if (LVGL_VERSION_MAJOR == 8 && LV_MEM_CUSTOM == 0) || \
+    (LVGL_VERSION_MAJOR == 9 && LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN)
+#define MEM_PLAN_LVGL_BUILTIN 1
+#else
+#define MEM_PLAN_LVGL_BUILTIN 0         // LVGL allocates from the heap
+#endif
+
+// LVGL's built-in pool must come from the plan (see mem_plan_lvgl_pool()
+// and the README); left to itself LVGL keeps LV_MEM_SIZE as a static array
+// the budget never sees
+#if MEM_PLAN_LVGL_BUILTIN && !defined(LV_MEM_POOL_ALLOC)
+#error "lv_conf.h: LVGL's built-in allocator needs LV_MEM_POOL_ALLOC mem_plan_lvgl_pool (see README)"
+#endif
+#if MEM_PLAN_LVGL_BUILTIN
+#define MEM_PLAN_LVGL_POOL LV_MEM_SIZE
+#else
+#define MEM_PLAN_LVGL_POOL 0
+#endif
+
+// PSRAM boards keep the sprite cache out there
+#if !SPRITE_CACHE || defined(BOARD_HAS_PSRAM)
+#define MEM_PLAN_SPRITE_CACHE 0
+#else
+#define MEM_PLAN_SPRITE_CACHE SPRITE_CACHE_BUDGET
+#endif
+
+/*
+  Arenas: id, name for the startup report, bytes. Order is layout order.
+*/
+#define MEM_ARENAS(X) \
+    X(MEM_ARENA_LVGL_POOL,    "lvgl_pool",    MEM_PLAN_LVGL_POOL)                           \
+    X(MEM_ARENA_DRAW_BUF,     "draw_buf",     LV_XIAO_DRAW_BUF_BYTES * (LVGL_DMA_FLUSH ? 2 : 1)) \
+    X(MEM_ARENA_TENSOR,       "tensor_arena", GESTURE_TENSOR_ARENA_SIZE)                    \
+    X(MEM_ARENA_IMU_RING,     "imu_ring",     IMU_RING_FRAMES * sizeof(imu_frame_t))        \
+    X(MEM_ARENA_SPRITE_CACHE, "sprite_cache", MEM_PLAN_SPRITE_CACHE)                        \
+    X(MEM_ARENA_SPRITE_RLE,   "sprite_rle",   SPRITE_RLE_SCRATCH_BYTES)                     \
+    X(MEM_ARENA_STACK_COMP,   "stack_comp",   STACK_COMP_POOL_BYTES)
+
+#define MEM_ARENA_ENUM(id, name, bytes) id,
+typedef enum {
+    MEM_ARENAS(MEM_ARENA_ENUM)
+    MEM_ARENA_COUNT
+} mem_arena_id_t;
+#undef MEM_ARENA_ENUM
+
+#define MEM_ARENA_SIZE(id, name, bytes) (uint32_t)(bytes),
+static constexpr uint32_t mem_arena_sizes[MEM_ARENA_COUNT] = { MEM_ARENAS(MEM_ARENA_SIZE) };
+#undef MEM_ARENA_SIZE
+
+#define MEM_PLAN_ALIGN_UP(n) (((n) + MEM_PLAN_ALIGN - 1) & ~(uint32_t)(MEM_PLAN_ALIGN - 1))
+
+// Start of arena 'id' in the region; mem_plan_offset(MEM_ARENA_COUNT) is the total
+static constexpr uint32_t mem_plan_offset(int id)
+{
+    return id == 0 ? 0 : mem_plan_offset(id - 1) + MEM_PLAN_ALIGN_UP(mem_arena_sizes[id - 1]);
+}
+
+#define MEM_PLAN_TOTAL mem_plan_offset(MEM_ARENA_COUNT)
+
+extern uint8_t mem_plan_region[];
+
+// Address of an arena; a constant, so it can initialise other statics
+#define MEM_ARENA(id)       ((void *)(mem_plan_region + mem_plan_offset(id)))
+#define MEM_ARENA_BYTES(id) (mem_arena_sizes[id])
+
+const char *mem_arena_name(mem_arena_id_t id);
+
+// Prints every arena's offset and size, the total and what's left of the budget
+void mem_plan_print(void);
+
+/*
+  For lv_conf.h, so LVGL's built-in allocator takes its pool from the plan:
+    #define LV_MEM_POOL_INCLUDE  <stddef.h>
+    #define LV_MEM_POOL_ALLOC    mem_plan_lvgl_pool
+  with the prototype declared extern "C" there (the README has the lines).
+  Returns NULL if LV_MEM_SIZE grew past the planned arena.
+*/
+extern "C" void *mem_plan_lvgl_pool(size_t size);
+
+#endif // MEM_PLAN_H
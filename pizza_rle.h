@@ -0,0 +1,191 @@
+// Generated by host/sprite_rle_convert from pizza.h; see sprite_rle.h
+#ifndef PIZZA_RLE_H
+#define PIZZA_RLE_H
+
+#include "sprite_rle.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "the palettes are RGB565 + A8; regenerate from the raw header for other depths"
+#endif
+
+// pizza000: 16x16, 5 colours, 265 bytes (raw 768)
+static const uint8_t pizza000_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xa7, 0x92, 0xff,
+  0xc8, 0x92, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0x92, 0xa7, 0xff,
+  0x92, 0xc8, 0xff,
+#endif
+};
+static const uint16_t pizza000_rows[] = {
+  0, 16, 34, 52, 70, 86, 102, 118, 134, 148, 162, 174, 186, 196, 204, 212,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t pizza000_runs[] = {
+  0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x0e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02,
+  0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x02, 0x0c, 0x00, 0x01, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x03, 0x04, 0x03, 0x00, 0x02, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x03, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0x00, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x05, 0x06, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x00, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x04, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0x00, 0x07, 0x02, 0x00, 0x00, 0x07, 0x00,
+};
+static const sprite_rle_t pizza000_rle = {
+  SPRITE_RLE_MAGIC, 5, pizza000_palette, pizza000_rows, pizza000_runs
+};
+
+const lv_img_dsc_t pizza000 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(pizza000_rle),
+  .data = (const uint8_t *)&pizza000_rle,
+};
+
+// pizza001: 16x16, 7 colours, 265 bytes (raw 768)
+static const uint8_t pizza001_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xa6, 0xb1, 0xff,
+  0x86, 0xa9, 0xff, 0xa6, 0xa9, 0xff, 0x86, 0xb1, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0xb1, 0xa6, 0xff,
+  0xa9, 0x86, 0xff, 0xa9, 0xa6, 0xff, 0xb1, 0x86, 0xff,
+#endif
+};
+static const uint16_t pizza001_rows[] = {
+  0, 16, 34, 52, 60, 78, 96, 112, 128, 142, 156, 168, 180, 190, 198, 206,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t pizza001_runs[] = {
+  0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x0e, 0x00, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x02, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x0e, 0x03, 0x04,
+  0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x00, 0x01, 0x0e,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x01, 0x00,
+  0x02, 0x0c, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x02, 0x00,
+  0x02, 0x0c, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x02, 0x00,
+  0x03, 0x0a, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x00, 0x03, 0x0a,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x03, 0x00, 0x04, 0x08, 0x05, 0x06,
+  0x05, 0x06, 0x05, 0x06, 0x05, 0x06, 0x04, 0x00, 0x04, 0x08, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x03, 0x04, 0x04, 0x00, 0x05, 0x06, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x05, 0x00, 0x06, 0x04,
+  0x03, 0x04, 0x03, 0x04, 0x06, 0x00, 0x06, 0x04, 0x05, 0x06, 0x05, 0x06, 0x06, 0x00, 0x07, 0x02,
+  0x05, 0x06, 0x07, 0x00,
+};
+static const sprite_rle_t pizza001_rle = {
+  SPRITE_RLE_MAGIC, 7, pizza001_palette, pizza001_rows, pizza001_runs
+};
+
+const lv_img_dsc_t pizza001 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(pizza001_rle),
+  .data = (const uint8_t *)&pizza001_rle,
+};
+
+// pizza002: 16x16, 5 colours, 263 bytes (raw 768)
+static const uint8_t pizza002_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x0d, 0xdd, 0xff, 0xc7, 0x92, 0xff, 0xa8, 0x92, 0xff, 0xa7, 0xff, 0xff,
+  0x87, 0xff, 0xff,
+#else
+  0xdd, 0x0d, 0xff, 0x92, 0xc7, 0xff, 0x92, 0xa8, 0xff, 0xff, 0xa7, 0xff,
+  0xff, 0x87, 0xff,
+#endif
+};
+static const uint16_t pizza002_rows[] = {
+  0, 16, 34, 52, 60, 78, 98, 116, 132, 147, 159, 172, 184, 194, 202, 210,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t pizza002_runs[] = {
+  0x02, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+  0x01, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x01, 0x0e, 0x00, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x00, 0x0c, 0x01, 0x00, 0x01, 0x00, 0x01, 0x02, 0x03, 0x04,
+  0x02, 0x03, 0x03, 0x04, 0x03, 0x02, 0x05, 0x03, 0x04, 0x03, 0x04, 0x03, 0x01, 0x00, 0x01, 0x04,
+  0x03, 0x04, 0x03, 0x04, 0x01, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x01, 0x00, 0x02, 0x01, 0x03, 0x01, 0x08, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x01,
+  0x01, 0x03, 0x02, 0x00, 0x02, 0x0c, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x03, 0x04, 0x02, 0x00, 0x03, 0x05, 0x03, 0x04, 0x03, 0x04, 0x03, 0x01, 0x04, 0x03, 0x04, 0x03,
+  0x04, 0x03, 0x00, 0x04, 0x08, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04, 0x04, 0x00, 0x04,
+  0x04, 0x03, 0x04, 0x03, 0x04, 0x01, 0x03, 0x03, 0x04, 0x03, 0x04, 0x00, 0x05, 0x01, 0x03, 0x01,
+  0x02, 0x03, 0x04, 0x01, 0x01, 0x03, 0x05, 0x00, 0x05, 0x06, 0x03, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x05, 0x00, 0x06, 0x04, 0x03, 0x04, 0x03, 0x04, 0x06, 0x00, 0x06, 0x04, 0x03, 0x04, 0x03, 0x04,
+  0x06, 0x00, 0x07, 0x02, 0x03, 0x04, 0x07, 0x00,
+};
+static const sprite_rle_t pizza002_rle = {
+  SPRITE_RLE_MAGIC, 5, pizza002_palette, pizza002_rows, pizza002_runs
+};
+
+const lv_img_dsc_t pizza002 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(pizza002_rle),
+  .data = (const uint8_t *)&pizza002_rle,
+};
+
+// pizza003: 16x16, 5 colours, 150 bytes (raw 768)
+static const uint8_t pizza003_palette[] = {
+#if LV_COLOR_16_SWAP == 0
+  0x06, 0x6e, 0xff, 0xe6, 0x6d, 0xff, 0xa6, 0xb1, 0xff, 0x86, 0xa9, 0xff,
+  0x86, 0xb1, 0xff,
+#else
+  0x6e, 0x06, 0xff, 0x6d, 0xe6, 0xff, 0xb1, 0xa6, 0xff, 0xa9, 0x86, 0xff,
+  0xb1, 0x86, 0xff,
+#endif
+};
+static const uint16_t pizza003_rows[] = {
+  0, 2, 4, 6, 8, 18, 33, 43, 51, 58, 67, 72, 77, 84, 89, 97,
+};
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t pizza003_runs[] = {
+  0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x10, 0x00, 0x01, 0x02, 0x00, 0x01, 0x0a, 0x02, 0x00, 0x01,
+  0x01, 0x00, 0x02, 0x01, 0x00, 0x01, 0x01, 0x02, 0x03, 0x02, 0x00, 0x01, 0x03, 0x01, 0x00, 0x02,
+  0x00, 0x03, 0x03, 0x02, 0x03, 0x02, 0x02, 0x01, 0x00, 0x07, 0x00, 0x04, 0x01, 0x02, 0x05, 0x01,
+  0x02, 0x05, 0x00, 0x09, 0x03, 0x02, 0x03, 0x02, 0x04, 0x00, 0x05, 0x02, 0x00, 0x01, 0x03, 0x01,
+  0x02, 0x05, 0x00, 0x05, 0x01, 0x00, 0x0a, 0x00, 0x07, 0x01, 0x02, 0x08, 0x00, 0x06, 0x03, 0x02,
+  0x03, 0x02, 0x07, 0x00, 0x07, 0x01, 0x02, 0x08, 0x00, 0x06, 0x01, 0x00, 0x02, 0x01, 0x02, 0x06,
+  0x00, 0x07, 0x02, 0x00, 0x04, 0x07, 0x00,
+};
+static const sprite_rle_t pizza003_rle = {
+  SPRITE_RLE_MAGIC, 5, pizza003_palette, pizza003_rows, pizza003_runs
+};
+
+const lv_img_dsc_t pizza003 = {
+  .header = {
+      .cf = SPRITE_RLE_CF,
+      .always_zero = 0,
+      .reserved = 0,
+      .w = 16,
+      .h = 16,
+  },
+  .data_size = sizeof(pizza003_rle),
+  .data = (const uint8_t *)&pizza003_rle,
+};
+
+// Largest layer unpacked
+#define PIZZA_RLE_MAX_LAYER_BYTES 768
+#if SPRITE_RLE_ASSETS
+static_assert(PIZZA_RLE_MAX_LAYER_BYTES <= SPRITE_RLE_SCRATCH_BYTES,
+              "a layer outgrew the scratch; raise SPRITE_RLE_MAX_LAYER_BYTES");
+#endif
+
+#endif // PIZZA_RLE_H
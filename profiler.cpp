@@ -0,0 +1,261 @@
+#include "profiler.h"
+#include "lv_xiao_round_screen.h"
+
+#if defined(ESP32)
+#include <esp_timer.h>
+#elif !defined(ARDUINO)
+#include <chrono>
+#endif
+
+#define PROF_SCOPE_NAME(id, name) name,
+static const char *const scope_names[] = {
+    PROF_SCOPES(PROF_SCOPE_NAME)
+};
+#undef PROF_SCOPE_NAME
+
+static prof_scope_t scopes[PROF_SCOPE_COUNT];
+static prof_scope_t frame;                 // loop() period, same statistics
+
+// Overlay window
+static uint32_t    window_start_us = 0;
+static uint32_t    window_frames   = 0;
+static uint64_t    window_us[PROF_SCOPE_COUNT];
+static uint32_t    window_flush_us = 0;    // from the display driver's own stats
+static lv_obj_t   *overlay_label   = NULL;
+static lv_timer_t *overlay_timer   = NULL;
+
+//----------------------- Tick source ------------------------
+
+#if defined(NRF52_SERIES) || defined(NRF52840_XXAA) || defined(ARDUINO_ARCH_NRF52)
+static uint32_t ticks_per_us = 64;
+
+void prof_init(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL  |= DWT_CTRL_CYCCNTENA_Msk;
+    ticks_per_us = SystemCoreClock / 1000000;
+    prof_reset();
+}
+
+uint32_t prof_ticks(void)
+{
+    return DWT->CYCCNT;
+}
+
+#elif defined(ESP32)
+static const uint32_t ticks_per_us = 1;
+
+void prof_init(void)
+{
+    prof_reset();
+}
+
+uint32_t prof_ticks(void)
+{
+    return (uint32_t)esp_timer_get_time();
+}
+
+#elif !defined(ARDUINO)
+static const uint32_t ticks_per_us = 1;
+
+void prof_init(void)
+{
+    prof_reset();
+}
+
+uint32_t prof_ticks(void)
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#else
+// Any other board: micros() is all there is
+static const uint32_t ticks_per_us = 1;
+
+void prof_init(void)
+{
+    prof_reset();
+}
+
+uint32_t prof_ticks(void)
+{
+    return micros();
+}
+#endif
+
+uint32_t prof_ticks_to_us(uint32_t ticks)
+{
+    return ticks / ticks_per_us;
+}
+
+//----------------------- Scopes ------------------------
+
+#if PROFILER
+void prof_begin(prof_scope_id_t id)
+{
+    scopes[id].start = prof_ticks();
+}
+
+void prof_end(prof_scope_id_t id)
+{
+    prof_scope_t *s = &scopes[id];
+    s->frame_ticks += prof_ticks() - s->start;
+    s->frame_calls++;
+}
+#endif
+
+static uint8_t hist_bucket(uint32_t us)
+{
+    uint8_t b = 0;
+    us >>= PROF_HIST_MIN_SHIFT;
+    while (us && b < PROF_HIST_BUCKETS - 1) {
+        us >>= 1;
+        b++;
+    }
+    return b;
+}
+
+static void fold(prof_scope_t *s, uint32_t us, uint32_t calls)
+{
+    s->calls    += calls;
+    s->frames++;
+    s->total_us += us;
+    if (us > s->max_us) {
+        s->max_us = us;
+    }
+    s->hist[hist_bucket(us)]++;
+}
+
+void prof_frame_end(void)
+{
+    static uint32_t last_frame = 0;
+    uint32_t now = prof_ticks();
+    if (last_frame != 0) {
+        fold(&frame, prof_ticks_to_us(now - last_frame), 1);
+        window_frames++;
+    }
+    last_frame = now;
+
+    for (uint8_t i = 0; i < PROF_SCOPE_COUNT; i++) {
+        prof_scope_t *s = &scopes[i];
+        if (s->frame_calls == 0) {
+            continue;
+        }
+        uint32_t us = prof_ticks_to_us(s->frame_ticks);
+        fold(s, us, s->frame_calls);
+        window_us[i] += us;
+        s->frame_ticks = 0;
+        s->frame_calls = 0;
+    }
+}
+
+const prof_scope_t *prof_scope(prof_scope_id_t id)
+{
+    return &scopes[id];
+}
+
+const char *prof_scope_name(prof_scope_id_t id)
+{
+    return scope_names[id];
+}
+
+void prof_reset(void)
+{
+    memset(scopes, 0, sizeof(scopes));
+    memset(&frame, 0, sizeof(frame));
+    memset(window_us, 0, sizeof(window_us));
+    window_frames   = 0;
+    window_start_us = micros();
+    window_flush_us = xiao_flush_stats()->flush_us + xiao_flush_stats()->wait_us;
+}
+
+//----------------------- CSV ------------------------
+
+static void print_row(const char *name, const prof_scope_t *s)
+{
+    Serial.print(name);
+    Serial.print(",");
+    Serial.print(s->calls);
+    Serial.print(",");
+    Serial.print(s->frames);
+    Serial.print(",");
+    Serial.print(s->frames ? (uint32_t)(s->total_us / s->frames) : 0);
+    Serial.print(",");
+    Serial.print(s->max_us);
+    for (uint8_t b = 0; b < PROF_HIST_BUCKETS; b++) {
+        Serial.print(",");
+        Serial.print(s->hist[b]);
+    }
+    Serial.println();
+}
+
+void prof_print_csv(void)
+{
+    Serial.print("scope,calls,frames,avg_us,max_us");
+    for (uint8_t b = 0; b < PROF_HIST_BUCKETS; b++) {
+        Serial.print(b < PROF_HIST_BUCKETS - 1 ? ",<" : ",>=");
+        Serial.print(1UL << (PROF_HIST_MIN_SHIFT + (b < PROF_HIST_BUCKETS - 1 ? b : b - 1)));
+        Serial.print("us");
+    }
+    Serial.println();
+
+    print_row("frame", &frame);
+    for (uint8_t i = 0; i < PROF_SCOPE_COUNT; i++) {
+        print_row(scope_names[i], &scopes[i]);
+    }
+}
+
+//----------------------- Overlay ------------------------
+
+static void overlay_timer_cb(lv_timer_t *timer)
+{
+    uint32_t now     = micros();
+    uint32_t elapsed = now - window_start_us;
+    uint32_t flushed = xiao_flush_stats()->flush_us + xiao_flush_stats()->wait_us;
+    if (elapsed == 0 || window_frames == 0) {
+        return;
+    }
+
+    // The driver's stats restart when the buffer size changes
+    uint32_t flush_us  = flushed >= window_flush_us ? flushed - window_flush_us : flushed;
+
+    // Render = LVGL's own work, without the time it spent pushing pixels out
+    uint32_t lvgl_us   = window_us[PROF_LVGL];
+    uint32_t render_us = lvgl_us > flush_us ? lvgl_us - flush_us : 0;
+
+    char text[64];
+    snprintf(text, sizeof(text), "%lu fps  render %lu.%lu ms\nflush %lu.%lu ms  idle %lu%%",
+             (unsigned long)((uint64_t)window_frames * 1000000 / elapsed),
+             (unsigned long)(render_us / window_frames / 1000),
+             (unsigned long)(render_us / window_frames / 100 % 10),
+             (unsigned long)(flush_us / window_frames / 1000),
+             (unsigned long)(flush_us / window_frames / 100 % 10),
+             (unsigned long)(window_us[PROF_IDLE] * 100 / elapsed));
+    lv_label_set_text(overlay_label, text);
+
+    memset(window_us, 0, sizeof(window_us));
+    window_frames   = 0;
+    window_start_us = now;
+    window_flush_us = flushed;
+}
+
+void prof_overlay_show(bool show)
+{
+    if (show && !overlay_label) {
+        overlay_label = lv_label_create(lv_layer_top());
+        lv_obj_set_style_text_color(overlay_label, lv_color_hex(0xFFFFFF), 0);
+        lv_obj_set_style_bg_color(overlay_label, lv_color_hex(0x000000), 0);
+        lv_obj_set_style_bg_opa(overlay_label, LV_OPA_50, 0);
+        lv_obj_set_style_text_align(overlay_label, LV_TEXT_ALIGN_CENTER, 0);
+        lv_obj_align(overlay_label, LV_ALIGN_TOP_MID, 0, 28);   // inside the round panel
+        lv_label_set_text(overlay_label, "");
+        overlay_timer = lv_timer_create(overlay_timer_cb, PROF_OVERLAY_MS, NULL);
+    } else if (!show && overlay_label) {
+        lv_timer_del(overlay_timer);
+        lv_obj_del(overlay_label);
+        overlay_timer = NULL;
+        overlay_label = NULL;
+    }
+}
@@ -0,0 +1,107 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Set to 0 to compile every PROF_* call out
+#ifndef PROFILER
+#define PROFILER 1
+#endif
+
+// Set to 1 to show fps / render / flush / idle on screen from setup()
+#ifndef PROFILER_OVERLAY
+#define PROFILER_OVERLAY 0
+#endif
+
+// Print the CSV report this often from loop(); 0 = only on request
+#ifndef PROFILER_CSV_MS
+#define PROFILER_CSV_MS 0
+#endif
+
+#define PROF_HIST_BUCKETS   12      // per-frame time: <64us, <128us, ... , >=65ms
+#define PROF_HIST_MIN_SHIFT 6       // first bucket edge, 2^6 us
+#define PROF_OVERLAY_MS     500     // overlay refresh period
+
+/*
+  Named scopes: id, then the name used in the CSV. The frame itself is not a
+  scope; prof_frame_end() times it from one call to the next.
+*/
+#define PROF_SCOPES(X) \
+    X(PROF_TOUCH,       "touch")        \
+    X(PROF_GESTURES,    "gestures")     \
+    X(PROF_LVGL,        "lv_timer")     \
+    X(PROF_SPRITE_EXEC, "sprite_exec")  \
+    X(PROF_COMPOSE,     "compose")      \
+    X(PROF_LOG,         "log_drain")    \
+    X(PROF_IDLE,        "idle")
+
+#define PROF_SCOPE_ENUM(id, name) id,
+typedef enum {
+    PROF_SCOPES(PROF_SCOPE_ENUM)
+    PROF_SCOPE_COUNT
+} prof_scope_id_t;
+#undef PROF_SCOPE_ENUM
+
+typedef struct {
+    uint32_t start;                        // tick count at prof_begin()
+    uint32_t frame_ticks;                  // accumulated this frame
+    uint32_t frame_calls;
+    uint32_t calls;                        // since the last reset
+    uint32_t frames;                       // frames the scope ran in
+    uint64_t total_us;
+    uint32_t max_us;                       // worst single frame
+    uint16_t hist[PROF_HIST_BUCKETS];      // frames by time spent in the scope
+} prof_scope_t;
+
+// Starts the cycle counter; call once before anything is timed
+void prof_init(void);
+
+/**
+ * @brief Raw tick source: DWT->CYCCNT on Cortex-M4, esp_timer on ESP32,
+ *        std::chrono on the host. Wraps; only differences are meaningful.
+ */
+uint32_t prof_ticks(void);
+uint32_t prof_ticks_to_us(uint32_t ticks);
+
+#if PROFILER
+void prof_begin(prof_scope_id_t id);
+void prof_end(prof_scope_id_t id);
+
+// Times the rest of the enclosing block
+class prof_scope_guard {
+public:
+    explicit prof_scope_guard(prof_scope_id_t id) : id_(id) { prof_begin(id_); }
+    ~prof_scope_guard() { prof_end(id_); }
+private:
+    prof_scope_id_t id_;
+};
+#define PROF_SCOPE_CAT_(a, b) a##b
+#define PROF_SCOPE_CAT(a, b)  PROF_SCOPE_CAT_(a, b)
+#define PROF_SCOPE(id)        prof_scope_guard PROF_SCOPE_CAT(prof_guard_, __LINE__)(id)
+#else
+#define prof_begin(id)  do {} while (0)
+#define prof_end(id)    do {} while (0)
+#define PROF_SCOPE(id)  do {} while (0)
+#endif
+
+/**
+ * @brief Closes the frame: folds every scope's time into its histogram and
+ *        the overlay window. Call once at the end of loop().
+ */
+void prof_frame_end(void);
+
+const prof_scope_t *prof_scope(prof_scope_id_t id);
+const char *prof_scope_name(prof_scope_id_t id);
+void prof_reset(void);
+
+/**
+ * @brief Prints one CSV row per scope plus one for the frame: calls, frames,
+ *        avg/max us per frame and the histogram buckets.
+ */
+void prof_print_csv(void);
+
+// On-screen label on the top layer with fps, render ms, flush ms and idle %
+void prof_overlay_show(bool show);
+
+#endif // PROFILER_H
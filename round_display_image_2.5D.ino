@@ -1,25 +1,32 @@
 #define USE_ARDUINO_GFX_LIBRARY
 #include <lvgl.h>
 #include "lv_xiao_round_screen.h"
-#include "touch_swipe.h"
 #include "touch_sensor_functions.h"
+#include "touch_events.h"
+#include "touch_gesture.h"
+#include "hit_regions.h"
+#include "stack_anim_check.h"
 #include "animations.h"
+#include "sprite_cache.h"
+#include "sprite_rle.h"
+#include "stack_compositor.h"
+#include "display_bench.h"
+#include "background.h"
+#include "background_bench.h"
+#include "event_log.h"
+#include "profiler.h"
+#include "heap_stats.h"
+#include "mem_plan.h"
 
 // ------------------- Arduino & IMU includes -------------------
 #include <Arduino.h>
 #include <LSM6DS3.h>
 #include <Wire.h>
 
-// ------------------- TensorFlow Lite includes -------------------
-#include <TensorFlowLite.h>
-#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
-#include <tensorflow/lite/micro/micro_error_reporter.h>
-#include <tensorflow/lite/micro/micro_interpreter.h>
-#include <tensorflow/lite/schema/schema_generated.h>
-
-// IMPORTANT: remove or comment out the old static model references if you like
-// them to be in flash only. We'll load them in a function on-demand.
-#include "model.h"  // your gesture_cnn_int8_model[] or dense int8 model
+// ------------------- TensorFlow Lite gesture engine -------------------
+#include "gesture_engine.h"
+#include "gesture_capture.h"
+#include "gesture_stream.h"
 
 //###############################################################
 //                IMU setup
@@ -27,24 +34,22 @@
 
 LSM6DS3 myIMU(I2C_MODE, 0x6A);
 
-// For demonstration, we'll do a single small buffer read in doSingleInferenceOnce()
-static const float accelerationThreshold = 2.3; // example threshold
-static const int   numSamples            = 179;  // 1.5 seconds worth of data
-int samplesRead = numSamples; // initially = done state
-
-// If your model class names differ, adapt these:
-static const char* GESTURES[] = {"bow", "sleep", "circle"};
-static const int   NUM_GESTURES = 3;  // or however many classes you have
-
 //###############################################################
 //            UI vars and functions
 //###############################################################
 
 //sprite hex code files
 #include "dino_sprites.h"
+#if SPRITE_RLE_ASSETS
+// Same images, compressed (sprite_rle.h); made by host/sprite_rle_convert
+#include "pizza_rle.h"
+#include "burger_rle.h"
+#include "bed_rle.h"
+#else
 #include "pizza.h"
 #include "burger.h"
 #include "bed.h"
+#endif
 
 // Example image declarations
 LV_IMG_DECLARE(tile000);  LV_IMG_DECLARE(tile001);  LV_IMG_DECLARE(tile002);
@@ -84,10 +89,8 @@ static const lv_img_dsc_t *bed_images[] = {
     &bed005, &bed006, &bed007
 };
 
-static swipe_tracker_t g_swipeTracker = {
-    SWIPE_IDLE, false, SWIPE_DIR_NONE, 
-    0,0, 0,0, 0,0
-};
+// Swipes that start on the dino; set up in setup()
+static touch_gesture_tracker_t g_swipeTracker;
 
 static pivot_sprite_t g_sprites_dino[15];
 static uint16_t       g_sprites_dino_count = 0;
@@ -101,6 +104,12 @@ static uint16_t       g_sprites_burger_count = 0;
 static pivot_sprite_t g_sprites_bed[8];
 static uint16_t       g_sprites_bed_count = 0;
 
+// One composited image per stack instead of one object per layer
+static sprite_stack_t g_stack_dino, g_stack_pizza, g_stack_burger, g_stack_bed;
+
+// Tap targets for the items; one lookup per touch sample
+static hit_registry_t g_hit_regions;
+
 static int32_t sprite_current_angle = 0;
 static int32_t pizza_current_angle  = 0;
 static int32_t burger_current_angle = 0;
@@ -111,32 +120,16 @@ uint8_t hunger_value    = 100;
 uint8_t happiness_value = 50;
 uint8_t energy_value    = 100;
 
+// Sky over grass, each half a vertical gradient
+static const background_band_t sky_and_grass[] = {
+    {0,   120, 0x4682B4, 0x87CEEB},   // Sky: light blue -> darker blue
+    {120, 120, 0x3CB371, 0x98FB98},   // Grass: light green -> darker green
+};
+#define SKY_AND_GRASS_BANDS (sizeof(sky_and_grass) / sizeof(sky_and_grass[0]))
+
 // Utility to set background gradient
 void set_gradient_background() {
-    // Create top half (sky) gradient
-    lv_obj_t *top_bg = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(top_bg);                 // Remove default styles
-    lv_obj_set_size(top_bg, 240, 120);               // Width=240, Height=120
-    lv_obj_align(top_bg, LV_ALIGN_TOP_LEFT, 0, 0);   // Place at (0,0)
-
-    // Sky gradient: Light blue -> Darker blue, vertical
-    lv_obj_set_style_bg_color(top_bg, lv_color_hex(0x4682B4), 0);  // Light blue
-    lv_obj_set_style_bg_grad_color(top_bg, lv_color_hex(0x87CEEB), 0);  // Darker blue
-    lv_obj_set_style_bg_grad_dir(top_bg, LV_GRAD_DIR_VER, 0);
-    lv_obj_set_style_bg_opa(top_bg, LV_OPA_COVER, 0);
-
-    // Create bottom half (grass) gradient
-    lv_obj_t *bottom_bg = lv_obj_create(lv_scr_act());
-    lv_obj_remove_style_all(bottom_bg);
-    lv_obj_set_size(bottom_bg, 240, 120);            // Another 240×120
-    // Position it immediately below the top half (y=120)
-    lv_obj_align(bottom_bg, LV_ALIGN_TOP_LEFT, 0, 120);
-
-    // Grass gradient: Light green -> Darker green, vertical
-    lv_obj_set_style_bg_color(bottom_bg, lv_color_hex(0x3CB371), 0);  // Light green
-    lv_obj_set_style_bg_grad_color(bottom_bg, lv_color_hex(0x98FB98), 0); // Darker green
-    lv_obj_set_style_bg_grad_dir(bottom_bg, LV_GRAD_DIR_VER, 0);
-    lv_obj_set_style_bg_opa(bottom_bg, LV_OPA_COVER, 0);
+    background_create(lv_scr_act(), sky_and_grass, SKY_AND_GRASS_BANDS, BACKGROUND_PRERENDERED);
 }
 
 
@@ -267,6 +260,11 @@ void create_sprites_pseudo_3d(const lv_img_dsc_t *image_list[],
         sprite_array[i].base_y       = base_y;
         sprite_array[i].index        = i;
         sprite_array[i].total_sprites= num_sprites;
+        sprite_array[i].src          = src;
+        sprite_array[i].cache        = NULL;
+        sprite_array[i].stack        = NULL;
+        sprite_array[i].half_w       = src->header.w / 2;
+        sprite_array[i].half_h       = src->header.h / 2;
         lv_img_set_angle(sprite_img, 0);
     }
 }
@@ -275,229 +273,39 @@ void create_sprites_pseudo_3d(const lv_img_dsc_t *image_list[],
 //  On-demand TFLite gesture recognition (One Iteration)
 // ---------------------------------------------------------
 
-#include <stdlib.h> // For malloc and free
-
-int freeMemory() {
-    // Allocate a block of memory and immediately free it
-    // The size of the block is arbitrary but should be large enough to trigger heap allocation
-    const size_t blockSize = 1024; // 1 KB
-    void* block = malloc(blockSize);
-
-    if (block == nullptr) {
-        // If malloc fails, there is no free memory left
-        return 0;
-    }
-
-    free(block); // Free the allocated block
-
-    // Measure the remaining free memory by allocating increasingly larger blocks
-    size_t freeMem = 0;
-    while (true) {
-        block = malloc(freeMem + blockSize);
-        if (block == nullptr) {
-            break; // Stop when malloc fails
-        }
-        free(block);
-        freeMem += blockSize;
-    }
-
-    return freeMem;
-}
-
-
-// We'll wrap the original "base code" logic in this function.
-// This runs a *blocking* 1.5s capture (if motion is detected).
-void runGestureCaptureAndInferenceOnce()
+// Reports the result of a bed capture or of a streamed detection
+static void gesture_result_cb(const gesture_result_t *result)
 {
-  Serial.println("=== Start on-demand TFLite + IMU capture ===");
-
-  // 1) Set up TFLite (allocate statically or dynamically).
-  Serial.println("Step 1: Creating MicroErrorReporter & MicroMutableOpResolver...");
-  static tflite::MicroErrorReporter tflErrorReporter;
-  static tflite::MicroMutableOpResolver<12> tflOpsResolver;
-
-  // Only add the ops your model needs:
-  tflOpsResolver.AddFullyConnected();
-  tflOpsResolver.AddConv2D();     // if CNN
-  tflOpsResolver.AddMaxPool2D();
-  tflOpsResolver.AddSoftmax();
-  tflOpsResolver.AddReshape();
-  tflOpsResolver.AddRelu();
-  tflOpsResolver.AddShape();
-  tflOpsResolver.AddReshape();
-  tflOpsResolver.AddStridedSlice();
-  tflOpsResolver.AddPack();
-  tflOpsResolver.AddExpandDims();
-  tflOpsResolver.AddMean();
-  Serial.println("Step 1 done.");
-
-  // 2) The Model
-  Serial.println("Step 2: Getting model pointer...");
-  const tflite::Model* tflModel = tflite::GetModel(model);
-  Serial.print("Model version: ");
-  Serial.println(tflModel->version());
-  if (tflModel->version() != TFLITE_SCHEMA_VERSION) {
-    Serial.println("Model schema version mismatch!");
-    return;
-  }
-  Serial.println("Step 2 done.");
-
-  // 3) Interpreter
-  Serial.println("Step 3: Creating MicroInterpreter...");
-  static constexpr int tensorArenaSize = 6 * 1024;
-  static uint8_t tensorArena[tensorArenaSize] __attribute__((aligned(16)));
-
-  tflite::MicroInterpreter* tflInterpreter =
-      new tflite::MicroInterpreter(tflModel, tflOpsResolver, tensorArena,
-                                   tensorArenaSize, &tflErrorReporter);
-  if(!tflInterpreter) {
-    Serial.println("Failed to create MicroInterpreter!");
-    return;
-  }
-  Serial.println("Step 3: MicroInterpreter created successfully.");
-
-  // 4) Allocate Tensors
-  Serial.println("Step 4: Allocating Tensors...");
-  TfLiteStatus allocStatus = tflInterpreter->AllocateTensors();
-  Serial.println("AllocateTensors call returned...");
-  if (allocStatus != kTfLiteOk) {
-    Serial.println("AllocateTensors() failed!");
-    delete tflInterpreter;
-    return;
-  }
-  Serial.println("Tensors allocated successfully.");
-
-  // 5) Print input shape (to confirm the model shape)
-  TfLiteTensor* tflInputTensor  = tflInterpreter->input(0);
-  TfLiteTensor* tflOutputTensor = tflInterpreter->output(0);
-  Serial.print("Input dims: ");
-  for (int i = 0; i < tflInputTensor->dims->size; i++) {
-    Serial.print(tflInputTensor->dims->data[i]);
-    Serial.print(" ");
-  }
-  Serial.println();
-
-  // 4) Get input & output quantization parameters
-  float input_scale       = 1.0f;
-  int   input_zero_point  = 0;
-  if (tflInputTensor->type == kTfLiteInt8) {
-    auto* quant_params_in = (TfLiteAffineQuantization*) tflInputTensor->quantization.params;
-    if (quant_params_in) {
-      input_scale      = quant_params_in->scale->data[0];
-      input_zero_point = quant_params_in->zero_point->data[0];
-    }
-  }
-  float output_scale      = 1.0f;
-  int   output_zero_point = 0;
-  if (tflOutputTensor->type == kTfLiteInt8) {
-    auto* quant_params_out = (TfLiteAffineQuantization*) tflOutputTensor->quantization.params;
-    if (quant_params_out) {
-      output_scale      = quant_params_out->scale->data[0];
-      output_zero_point = quant_params_out->zero_point->data[0];
-    }
-  }
-
-  // 5) Prepare to capture 179 samples for 1.5s window
-  samplesRead = numSamples; // indicates we are "idle"
-  unsigned long lastGestureStartTime = 0;
-
-  // The logic from your base code:
-
-  // Step A) Wait until motion is detected above threshold
-  while (true) {
-    float aX = myIMU.readFloatAccelX();
-    float aY = myIMU.readFloatAccelY();
-    float aZ = myIMU.readFloatAccelZ();
-
-    float aSum = fabs(aX) + fabs(aY) + fabs(aZ);
-
-    // Debug print:
-    Serial.print("aX=");
-    Serial.print(aX, 2);
-    Serial.print(" aY=");
-    Serial.print(aY, 2);
-    Serial.print(" aZ=");
-    Serial.print(aZ, 2);
-    Serial.print(" sum=");
-    Serial.println(aSum, 2);
-
-    if (aSum >= accelerationThreshold) {
-      // Begin collecting
-      samplesRead = 0;
-      lastGestureStartTime = millis();
-      break;
+    if (result->label < 0) {
+        LOG_WARN(LOG_EV_GESTURE_FAILED);
+        return;
     }
-    delay(100); // short delay to avoid busy loop
-  }
 
-  // Step B) Collect IMU data until we have numSamples
-  while (samplesRead < numSamples) {
-    float aX = myIMU.readFloatAccelX();
-    float aY = myIMU.readFloatAccelY();
-    float aZ = myIMU.readFloatAccelZ();
-    float gX = myIMU.readFloatGyroX();
-    float gY = myIMU.readFloatGyroY();
-    float gZ = myIMU.readFloatGyroZ();
-
-    // Normalize, quantize, store
-    int sample_index = samplesRead * 6;
-
-    float ax_norm = (aX + 4.0f) / 8.0f;
-    float ay_norm = (aY + 4.0f) / 8.0f;
-    float az_norm = (aZ + 4.0f) / 8.0f;
-    float gx_norm = (gX + 2000.0f) / 4000.0f;
-    float gy_norm = (gY + 2000.0f) / 4000.0f;
-    float gz_norm = (gZ + 2000.0f) / 4000.0f;
-
-    tflInputTensor->data.int8[sample_index + 0] = (int8_t)roundf((ax_norm / input_scale) + input_zero_point);
-    tflInputTensor->data.int8[sample_index + 1] = (int8_t)roundf((ay_norm / input_scale) + input_zero_point);
-    tflInputTensor->data.int8[sample_index + 2] = (int8_t)roundf((az_norm / input_scale) + input_zero_point);
-    tflInputTensor->data.int8[sample_index + 3] = (int8_t)roundf((gx_norm / input_scale) + input_zero_point);
-    tflInputTensor->data.int8[sample_index + 4] = (int8_t)roundf((gy_norm / input_scale) + input_zero_point);
-    tflInputTensor->data.int8[sample_index + 5] = (int8_t)roundf((gz_norm / input_scale) + input_zero_point);
-
-    samplesRead++;
-
-    // If done collecting, run inference
-    if (samplesRead >= numSamples) {
-      // Perform inference
-      TfLiteStatus invokeStatus = tflInterpreter->Invoke();
-      if (invokeStatus != kTfLiteOk) {
-        Serial.println("Invoke failed!");
-        break;
-      }
-
-      // Print output predictions
-      for (int i = 0; i < NUM_GESTURES; i++) {
-        int8_t outVal = tflOutputTensor->data.int8[i];
-        float prob = (outVal - output_zero_point) * output_scale;
-        Serial.print(GESTURES[i]);
-        Serial.print(": ");
-        Serial.println(prob, 3);
-      }
-      Serial.println();
+    // Output predictions, scores in thousandths
+    for (int i = 0; i < GESTURE_NUM_CLASSES; i++) {
+        LOG_INFO(LOG_EV_GESTURE_SCORE, i, (int)(result->scores[i] * 1000));
     }
-
-    delay(5);
-  }
-
-  // 6) Cleanup interpreter
-  delete tflInterpreter;
-  Serial.println("=== Done capturing + inference ===");
+    LOG_INFO(LOG_EV_GESTURE, result->label, (int)(result->scores[result->label] * 1000),
+             (int)result->latency_us);
 }
 
 static void bed_animation_complete_cb(lv_anim_t * anim)
 {
-    Serial.print("Free RAM before TFLM: ");
-    Serial.println(freeMemory());
+    // Runs inside lv_timer_handler(); the running totals, not a heap walk
+    const heap_tag_stats_t *heap = heap_total_stats();
+    LOG_DEBUG(LOG_EV_CAPTURE_ARMED, heap->bytes, heap->peak);
 
-    // Now invoke TensorFlow inference
-    runGestureCaptureAndInferenceOnce();
+    // Arm a capture; it is advanced from an lv_timer so rendering keeps going
+    gesture_capture_start();
 }
 
 // ---------------------------------------------------------
 //  Bed press callback - run rotation + single inference
 // ---------------------------------------------------------
+static void stack_anim_rotate_with_inference(pivot_sprite_t *sprites, uint16_t sprite_count,
+                                             int32_t *current_angle, int32_t end_angle_offset,
+                                             uint32_t duration, bool infinite);
+
 void bed_press_callback(
     pivot_sprite_t *sprites,
     uint16_t        sprite_count,
@@ -525,45 +333,14 @@ static void stack_anim_rotate_with_inference(
     uint32_t        duration,
     bool            infinite)
 {
-    // 1) Make the local array 'static' so it persists after this function returns
-    lv_anim_t local_anim_storage[sprite_count];
-
-    int32_t start_angle = *current_angle;
-    int32_t end_angle   = start_angle + end_angle_offset;
-
-    // 2) Loop over each sprite in the stack
-    for (uint16_t i = 0; i < sprite_count && i < sprite_count; i++) {
-
-        // Stop any ongoing animations on this sprite
-        lv_anim_del(sprites[i].obj, NULL);
-
-        // Initialize the animation
-        lv_anim_init(&local_anim_storage[i]);
-
-        // Set all parameters BEFORE lv_anim_start
-        lv_anim_set_var(&local_anim_storage[i], &sprites[i]);
-        lv_anim_set_exec_cb(&local_anim_storage[i], rotate_anim);
-        lv_anim_set_time(&local_anim_storage[i], duration);
-        lv_anim_set_values(&local_anim_storage[i], start_angle, end_angle);
-
-        // If we want an infinite loop, no finish callback is possible
-        if(infinite) {
-            lv_anim_set_repeat_count(&local_anim_storage[i], LV_ANIM_REPEAT_INFINITE);
-        } 
-        else {
-            // Attach the finish callback ONLY on the last sprite in the stack
-            // so that it runs once the entire stack is finished
-            if(i == sprite_count - 1) {
-                lv_anim_set_ready_cb(&local_anim_storage[i], bed_animation_complete_cb);
-            }
-        }
-
-        // Now start the animation
-        lv_anim_start(&local_anim_storage[i]);
-    }
+    // The capture is armed once the whole stack has finished turning
+    stack_anim_ex(sprites, sprite_count, current_angle, end_angle_offset,
+                  duration, infinite, rotate_anim, bed_animation_complete_cb);
+}
 
-    // 3) Update the "current_angle" so next time we know our new final
-    *current_angle = end_angle;
+// Heap draw buffers (taller set_buffer_rows() sizes) show up under "app"
+static void *disp_buf_alloc(size_t bytes) {
+    return heap_malloc(HEAP_TAG_APP, bytes);
 }
 
 // ---------------------------------------------------------
@@ -578,13 +355,35 @@ void setup() {
         Serial.println("IMU not found!");
     } else {
         Serial.println("IMU found!");
+        // Accel + gyro frames are batched by the IMU and drained in bursts
+        imu_fifo_begin(&myIMU);
+    }
+
+    // Bring the gesture model up once; bed taps only cost an Invoke() afterwards
+    if (!gesture_engine_init()) {
+        Serial.println("Gesture engine init failed!");
     }
 
+    // Cycle counter for the PROF_* scopes
+    prof_init();
+
     // LVGL Setup
     lv_init();
+    lv_xiao_disp_use_buffers(MEM_ARENA(MEM_ARENA_DRAW_BUF),
+                             (uint8_t *)MEM_ARENA(MEM_ARENA_DRAW_BUF) + LV_XIAO_DRAW_BUF_BYTES);
+    lv_xiao_disp_set_allocator(disp_buf_alloc, heap_free);
     lv_xiao_disp_init();
     lv_xiao_touch_init();
 
+    // Decoder for the compressed item sprites
+    sprite_rle_init();
+
+    // One chsc6x read per controller report, shared by every touch consumer
+    touch_events_begin();
+
+    // Dino swipes: start inside 100..140 x 100..140, at least 20 px long
+    touch_gesture_init(&g_swipeTracker, 100, 140, 100, 140, 20);
+
     set_gradient_background();
 
     // Create arcs on screen
@@ -592,6 +391,15 @@ void setup() {
     create_arcs(screen);
     lv_scr_load(screen);
 
+    // Gesture capture state machine + its progress bar
+    gesture_capture_init(&myIMU, screen, gesture_result_cb);
+
+    // Continuous recognition over a sliding window (GESTURE_STREAM_MODE)
+    gesture_stream_init(NULL, gesture_result_cb);
+#if GESTURE_STREAM_MODE
+    gesture_stream_start();
+#endif
+
     // Create Dino sprites
     g_sprites_dino_count = 15;
     create_sprites_pseudo_3d(
@@ -620,6 +428,92 @@ void setup() {
         /*base_x=*/120, /*base_y=*/190, /*spacing_y=*/1, /*zoom_step=*/0
     );
 
+    // Flatten every stack into a single image; a stack that can't be
+    // composited keeps drawing its layers itself
+    stack_compositor_start();
+    uint8_t composited = 0;
+#if STACK_COMPOSITOR
+    // Each buffer leaves room for how far apart the stack's animations lift its layers
+    composited += sprite_stack_init(&g_stack_dino, g_sprites_dino, g_sprites_dino_count,
+                                    LV_MAX(stack_anim_lift(pet_anim, g_sprites_dino_count),
+                                           stack_anim_lift(rotate_anim, g_sprites_dino_count)));
+    composited += sprite_stack_init(&g_stack_pizza, g_sprites_pizza, g_sprites_pizza_count,
+                                    stack_anim_lift(item_anim, g_sprites_pizza_count));
+    composited += sprite_stack_init(&g_stack_burger, g_sprites_burger, g_sprites_burger_count,
+                                    stack_anim_lift(item_anim, g_sprites_burger_count));
+    composited += sprite_stack_init(&g_stack_bed, g_sprites_bed, g_sprites_bed_count,
+                                    stack_anim_lift(rotate_anim, g_sprites_bed_count));
+#endif
+    Serial.print("Composited stacks: ");
+    Serial.print(composited);
+    Serial.print(" (");
+    Serial.print((unsigned long)stack_compositor_pool_used());
+    Serial.print(" of ");
+    Serial.print((unsigned long)STACK_COMP_POOL_BYTES);
+    Serial.println(" B)");
+
+#if SPRITE_CACHE
+    // Optional pre-rotated frames (SPRITE_CACHE_BUDGET); items first since
+    // they are cheap, whatever is left goes to the dino
+    if (sprite_cache_init(SPRITE_CACHE_BUDGET) > 0) {
+        uint16_t cached = 0;
+        cached += sprite_cache_build(g_sprites_pizza,  g_sprites_pizza_count);
+        cached += sprite_cache_build(g_sprites_burger, g_sprites_burger_count);
+        cached += sprite_cache_build(g_sprites_bed,    g_sprites_bed_count);
+        cached += sprite_cache_build(g_sprites_dino,   g_sprites_dino_count);
+        Serial.print("Rotation cache: ");
+        Serial.print(cached);
+        Serial.print(" layers, ");
+        Serial.print((unsigned long)sprite_cache_used_bytes());
+        Serial.println(" bytes");
+    }
+#endif
+
+    // Items that start an animation when tapped
+    if (hit_registry_init(&g_hit_regions, 8)) {
+        // Pizza
+        hit_bind_anim(&g_hit_regions, hit_add_rect(&g_hit_regions, 50, 70, 170, 190),
+                      g_sprites_pizza, g_sprites_pizza_count, &pizza_current_angle,
+                      stack_anim_item, /*end_angle_offset=*/3600, /*duration=*/1600, false);
+        // Burger
+        hit_bind_anim(&g_hit_regions, hit_add_rect(&g_hit_regions, 170, 190, 170, 190),
+                      g_sprites_burger, g_sprites_burger_count, &burger_current_angle,
+                      stack_anim_item, 3600, 1600, false);
+        // Bed: bed_press_callback runs a single gesture inference
+        hit_bind_anim(&g_hit_regions, hit_add_rect(&g_hit_regions, 100, 140, 180, 200),
+                      g_sprites_bed, g_sprites_bed_count, &bed_current_angle,
+                      bed_press_callback, 3600, 2000, false);
+    }
+
+#if DISPLAY_BENCH
+    // Draw-buffer sweep; pick LVGL_BUFF_SIZE for the board from its output
+    display_bench_run(DISPLAY_BENCH_FRAMES);
+#endif
+
+#if BACKGROUND_BENCH
+    // Gradient objects vs the pre-rendered rows, full screen and sprite box
+    background_bench_run(sky_and_grass, SKY_AND_GRASS_BANDS, BACKGROUND_BENCH_FRAMES);
+#endif
+
+#if SPRITE_CACHE && SPRITE_CACHE_BENCH
+    // Pre-rotated frames vs live rotation for the dino's layers
+    sprite_cache_benchmark(g_sprites_dino, g_sprites_dino_count, rotate_anim,
+                           SPRITE_CACHE_BENCH_FRAMES);
+#endif
+
+#if STACK_ANIM_CHECK
+    // Per-stack driver vs one lv_anim per layer, pose for pose
+    stack_anim_check_run(g_sprites_dino, g_sprites_dino_count);
+#endif
+
+#if PROFILER_OVERLAY
+    prof_overlay_show(true);
+#endif
+
+    // Where the RAM went: the static plan, allocator stats and tagged allocations
+    mem_plan_print();
+    heap_print();
+
     Serial.println("Setup complete");
 }
 
@@ -628,11 +522,14 @@ void setup() {
 // ---------------------------------------------------------
 void loop() {
 
+  // Touch reports since the last pass; the checks below all read this snapshot
+  prof_begin(PROF_TOUCH);
+  touch_events_update();
+  prof_end(PROF_TOUCH);
+
+  prof_begin(PROF_GESTURES);
   // Existing swipe animation for Dino
   swipe_anim(
-      100, 140,  // x_min, x_max
-      100, 140,  // y_min, y_max
-      20,        // min_swipe_length
       &g_swipeTracker,
       &sprite_current_angle,
       g_sprites_dino,
@@ -644,46 +541,32 @@ void loop() {
       false
   );
 
-  // Pizza
-  touch_anim(
-      50, 70,      // x_min, x_max
-      170, 190,    // y_min, y_max
-      g_sprites_pizza,
-      g_sprites_pizza_count,
-      &pizza_current_angle,
-      stack_anim_item, // animation function
-      3600,            // end_angle_offset
-      1600,            // duration
-      false
-  );
+  // Pizza, burger and bed presses, once each
+  hit_dispatch(&g_hit_regions);
+  prof_end(PROF_GESTURES);
 
-  // Burger
-  touch_anim(
-      170, 190,
-      170, 190,
-      g_sprites_burger,
-      g_sprites_burger_count,
-      &burger_current_angle,
-      stack_anim_item,
-      3600,
-      1600,
-      false
-  );
+  prof_begin(PROF_LVGL);
+  lv_timer_handler();
+  prof_end(PROF_LVGL);
+
+  // Queued log records go out while the loop would otherwise sleep
+  prof_begin(PROF_LOG);
+  log_drain();
+  prof_end(PROF_LOG);
+
+#if PROFILER_CSV_MS
+  static uint32_t last_csv = 0;
+  if (millis() - last_csv >= PROFILER_CSV_MS) {
+    last_csv = millis();
+    prof_print_csv();
+  }
+#endif
 
-  // ** Bed sprite **
-  // Replace stack_anim_rotate with our bed_press_callback
-  touch_anim(
-      100, 140,
-      180, 200,
-      g_sprites_bed,
-      g_sprites_bed_count,
-      &bed_current_angle,
-      bed_press_callback,  // <--- calls single inference inside
-      3600,
-      2000,
-      false
-  );
+  // Idle, but a tap that starts and ends in here is still read with its point
+  prof_begin(PROF_IDLE);
+  touch_events_wait(16);
+  prof_end(PROF_IDLE);
 
-  lv_timer_handler();
-  delay(16);
+  prof_frame_end();
+  stack_inval_frame_end();
 }
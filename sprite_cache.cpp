@@ -0,0 +1,243 @@
+#include "sprite_cache.h"
+#include "stack_compositor.h"
+#include "mem_plan.h"
+#include "trig_lut.h"
+#include <math.h>
+
+#if SPRITE_CACHE
+static uint8_t            *pool       = NULL;
+static size_t              pool_size  = 0;
+static size_t              pool_used  = 0;
+static bool                cache_on   = true;
+
+static sprite_rot_cache_t  caches[SPRITE_CACHE_MAX_LAYERS];
+static uint16_t            cache_count = 0;
+
+//----------------------- Setup ------------------------
+
+size_t sprite_cache_init(size_t budget_bytes)
+{
+    if (pool || budget_bytes == 0) {
+        return pool_size;
+    }
+
+#if defined(BOARD_HAS_PSRAM)
+    pool = (uint8_t *)ps_malloc(budget_bytes);
+#else
+    // Internal RAM: the planned arena, never more than the plan gave it
+    budget_bytes = LV_MIN(budget_bytes, MEM_ARENA_BYTES(MEM_ARENA_SPRITE_CACHE));
+    pool = budget_bytes ? (uint8_t *)MEM_ARENA(MEM_ARENA_SPRITE_CACHE) : NULL;
+#endif
+    if (!pool) {
+        Serial.println("sprite_cache: could not reserve the pool, using live rotation");
+        return 0;
+    }
+    pool_size = budget_bytes;
+    pool_used = 0;
+    return pool_size;
+}
+
+uint16_t sprite_cache_build(pivot_sprite_t *sprites, uint16_t sprite_count)
+{
+    if (!pool) {
+        return 0;
+    }
+
+    // One scratch canvas renders every frame, then goes away again
+    lv_obj_t *canvas = lv_canvas_create(lv_scr_act());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+
+    uint16_t built = 0;
+    for (uint16_t i = 0; i < sprite_count && cache_count < SPRITE_CACHE_MAX_LAYERS; i++) {
+        const lv_img_dsc_t *src = sprites[i].src;
+        if (sprites[i].stack) {
+            continue;  // drawn by the stack compositor
+        }
+        if (lv_img_get_zoom(sprites[i].obj) != LV_IMG_ZOOM_NONE) {
+            continue;  // frames are rendered at 1:1 only
+        }
+        if (src->header.cf != LV_IMG_CF_TRUE_COLOR_ALPHA) {
+            continue;  // lv_canvas_transform() reads raw pixels only
+        }
+
+        lv_coord_t w    = src->header.w;
+        lv_coord_t h    = src->header.h;
+        lv_coord_t side = (lv_coord_t)ceilf(sqrtf((float)(w * w + h * h))) + 1;
+        size_t frame_bytes = LV_CANVAS_BUF_SIZE_TRUE_COLOR_ALPHA(side, side);
+        if (pool_used + frame_bytes * SPRITE_CACHE_STEPS > pool_size) {
+            continue;  // smaller layers further on may still fit
+        }
+
+        sprite_rot_cache_t *cache = &caches[cache_count++];
+        cache->side  = side;
+        cache->shown = -1;
+
+        for (uint16_t step = 0; step < SPRITE_CACHE_STEPS; step++) {
+            uint8_t *buf = pool + pool_used;
+            pool_used += frame_bytes;
+
+            lv_canvas_set_buffer(canvas, buf, side, side, LV_IMG_CF_TRUE_COLOR_ALPHA);
+            lv_canvas_fill_bg(canvas, lv_color_black(), LV_OPA_TRANSP);
+            lv_canvas_transform(canvas, (lv_img_dsc_t *)src,
+                                (int16_t)(step * 3600 / SPRITE_CACHE_STEPS), LV_IMG_ZOOM_NONE,
+                                (side - w) / 2, (side - h) / 2,
+                                w / 2, h / 2, true);
+
+            lv_img_dsc_t *frame = &cache->frames[step];
+            memset(frame, 0, sizeof(*frame));
+            frame->header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+            frame->header.w  = side;
+            frame->header.h  = side;
+            frame->data_size = frame_bytes;
+            frame->data      = buf;
+        }
+
+        sprites[i].cache = cache;
+        built++;
+    }
+
+    lv_obj_del(canvas);
+    return built;
+}
+
+void sprite_cache_set_enabled(bool enabled)
+{
+    cache_on = enabled;
+}
+
+bool sprite_cache_enabled(void)
+{
+    return cache_on;
+}
+
+size_t sprite_cache_used_bytes(void)
+{
+    return pool_used;
+}
+
+// Q15 product back to whole pixels, rounded half away from zero
+static inline int32_t q15_to_px(int32_t v)
+{
+    return v >= 0 ? (v + TRIG_Q15_ONE / 2) / TRIG_Q15_ONE
+                  : -((-v + TRIG_Q15_ONE / 2) / TRIG_Q15_ONE);
+}
+
+// Shows the frame nearest 'angle' instead of rotating the layer
+static void present_cached(pivot_sprite_t *layer, sprite_rot_cache_t *cache, int32_t angle,
+                           lv_coord_t pivot_x, lv_coord_t pivot_y,
+                           lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t *obj  = layer->obj;
+    int16_t   step = ((angle * SPRITE_CACHE_STEPS + 1800) / 3600) % SPRITE_CACHE_STEPS;
+    if (cache->shown != step) {
+        if (cache->shown < 0) {
+            lv_img_set_angle(obj, 0);
+        }
+        lv_img_set_src(obj, &cache->frames[step]);
+        cache->shown = step;
+    }
+
+    // Frames are rotated about the image centre; an off-centre pivot shifts
+    // the result by d - R*d, with d the pivot's offset from the centre and R
+    // the angle the frame was rendered at
+    lv_coord_t w  = layer->src->header.w;
+    lv_coord_t h  = layer->src->header.h;
+    int32_t    a  = step * TRIG_TURN / SPRITE_CACHE_STEPS;
+    int32_t    c  = trig_cos_q15(a);
+    int32_t    s  = trig_sin_q15(a);
+    int32_t    dx = pivot_x - w / 2;
+    int32_t    dy = pivot_y - h / 2;
+    lv_coord_t tx = (lv_coord_t)(dx - q15_to_px(dx * c - dy * s));
+    lv_coord_t ty = (lv_coord_t)(dy - q15_to_px(dx * s + dy * c));
+
+    lv_obj_set_pos(obj,
+                   x - (cache->side - w) / 2 + tx,
+                   y - (cache->side - h) / 2 + ty);
+}
+#endif // SPRITE_CACHE
+
+//----------------------- Per-frame path ------------------------
+
+void sprite_layer_present(pivot_sprite_t *layer, int32_t angle,
+                          lv_coord_t pivot_x, lv_coord_t pivot_y,
+                          lv_coord_t x, lv_coord_t y)
+{
+    lv_obj_t *obj = layer->obj;
+
+    angle %= 3600;
+    if (angle < 0) {
+        angle += 3600;
+    }
+
+    // Composited stacks draw all their layers in one go
+    if (layer->stack) {
+        sprite_stack_set_pose(layer->stack, layer->index, angle, pivot_x, pivot_y, x, y);
+        return;
+    }
+
+#if SPRITE_CACHE
+    sprite_rot_cache_t *cache = layer->cache;
+    if (cache && cache_on) {
+        present_cached(layer, cache, angle, pivot_x, pivot_y, x, y);
+        return;
+    }
+    if (cache && cache->shown >= 0) {
+        lv_img_set_src(obj, layer->src);
+        cache->shown = -1;
+    }
+#endif
+
+    lv_img_set_angle(obj, angle);
+    lv_img_set_pivot(obj, pivot_x, pivot_y);
+    lv_obj_set_pos(obj, x, y);
+}
+
+#if SPRITE_CACHE
+//----------------------- Benchmark ------------------------
+
+static uint32_t time_frames(pivot_sprite_t *sprites, uint16_t sprite_count,
+                            sprite_exec_cb_t exec_cb, uint16_t frames)
+{
+    uint32_t total = 0;
+    for (uint16_t f = 0; f < frames; f++) {
+        int32_t angle = (int32_t)f * 3600 / frames;
+        for (uint16_t i = 0; i < sprite_count; i++) {
+            exec_cb(&sprites[i], angle);
+        }
+        uint32_t start = micros();
+        lv_refr_now(NULL);
+        total += micros() - start;
+    }
+    return total;
+}
+
+void sprite_cache_benchmark(pivot_sprite_t *sprites, uint16_t sprite_count,
+                            sprite_exec_cb_t exec_cb, uint16_t frames)
+{
+    uint16_t cached = 0;
+    for (uint16_t i = 0; i < sprite_count; i++) {
+        cached += sprites[i].cache != NULL;
+    }
+    if (cached == 0) {
+        Serial.println("sprite_cache: no cached layers in this stack (composited, or no budget)");
+        return;
+    }
+
+    bool was_on = cache_on;
+
+    cache_on = false;
+    uint32_t live_us = time_frames(sprites, sprite_count, exec_cb, frames);
+    cache_on = true;
+    uint32_t cached_us = time_frames(sprites, sprite_count, exec_cb, frames);
+    cache_on = was_on;
+
+    Serial.print("sprite_cache live ms/frame: ");
+    Serial.print(live_us / 1000.0f / frames, 2);
+    Serial.print(" cached ms/frame: ");
+    Serial.print(cached_us / 1000.0f / frames, 2);
+    Serial.print(" cached layers: ");
+    Serial.print(cached);
+    Serial.print(" pool used: ");
+    Serial.println((unsigned long)pool_used);
+}
+#endif // SPRITE_CACHE
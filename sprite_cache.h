@@ -0,0 +1,117 @@
+#ifndef SPRITE_CACHE_H
+#define SPRITE_CACHE_H
+
+#include <lvgl.h>
+#include "animations.h"
+
+/*
+   Optional angle-quantised rotation cache for sprite-stack layers.
+
+   Every cached layer gets SPRITE_CACHE_STEPS pre-rotated copies of its image,
+   rendered once at boot with lv_canvas_transform() so they look exactly like
+   LVGL's live rotation at those angles. The exec callbacks then swap the
+   image source instead of asking LVGL to rotate + blend each layer per frame.
+
+   A w x h layer's frames are side x side with side = ceil(sqrt(w^2 + h^2)) + 1,
+   3 bytes a pixel: 24*24*3 per step for a 16x16 item layer (54 KB at 32
+   steps), 92*92*3 for a 64x64 dino layer (~794 KB). Layers are cached in the
+   order they are registered until SPRITE_CACHE_BUDGET runs out; the rest stay
+   on the live rotation path. Needs LV_USE_CANVAS.
+
+   This is the fallback for stacks the compositor (stack_compositor.h) does
+   not draw: it skips composited layers, and in the default build every stack
+   is composited, so the cache stays empty. It serves stacks that
+   sprite_stack_init() turned down (zoomed layers, more than
+   STACK_COMP_MAX_STACKS, no room left in STACK_COMP_POOL_BYTES) and builds
+   with STACK_COMPOSITOR 0, on boards that give it a budget. Only raw layers
+   are cached (SPRITE_RLE_ASSETS 0).
+
+   SPRITE_CACHE 0 compiles all of it out: sprite_layer_present() is then
+   only the compositor hand-off and live rotation, and the per-layer cache
+   slots (~18 KB) are gone. On by default only on PSRAM boards, the ones
+   with a default budget; elsewhere set SPRITE_CACHE 1 together with a
+   SPRITE_CACHE_BUDGET. The XIAO nRF52840 this sketch targets has no PSRAM,
+   so the cache isn't built or run on it today.
+*/
+
+#ifndef SPRITE_CACHE
+#if defined(BOARD_HAS_PSRAM)
+#define SPRITE_CACHE 1
+#else
+#define SPRITE_CACHE 0
+#endif
+#endif
+
+// Set to 1 to time the dino stack with the cache on and off at the end of
+// setup(); needs SPRITE_CACHE, STACK_COMPOSITOR 0 and a budget to have
+// anything to time
+#ifndef SPRITE_CACHE_BENCH
+#define SPRITE_CACHE_BENCH 0
+#endif
+
+#define SPRITE_CACHE_BENCH_FRAMES 120  // refreshes per pass, one full turn
+
+#ifndef SPRITE_CACHE_STEPS
+#define SPRITE_CACHE_STEPS  32          // angle steps per full turn
+#endif
+
+#ifndef SPRITE_CACHE_BUDGET
+#if defined(BOARD_HAS_PSRAM)
+#define SPRITE_CACHE_BUDGET (4UL * 1024 * 1024)
+#else
+#define SPRITE_CACHE_BUDGET 0UL         // off unless the board has room for it
+#endif
+#endif
+
+#define SPRITE_CACHE_MAX_LAYERS 48
+
+typedef struct sprite_rot_cache_t {
+    lv_coord_t     side;                         // rotated frames are side x side
+    lv_img_dsc_t   frames[SPRITE_CACHE_STEPS];   // one descriptor per angle step
+    int16_t        shown;                        // step currently set as source, -1 = original
+} sprite_rot_cache_t;
+
+/**
+ * @brief Reserves the pixel pool (once) for the cache.
+ *
+ * @param budget_bytes  0 disables caching entirely
+ * @return bytes actually reserved
+ */
+size_t sprite_cache_init(size_t budget_bytes);
+
+/**
+ * @brief Pre-rotates as many layers of a stack as the remaining budget allows.
+ *        Layers must already be created with create_sprites_pseudo_3d().
+ *
+ * @return number of layers that got a cache
+ */
+uint16_t sprite_cache_build(pivot_sprite_t *sprites, uint16_t sprite_count);
+
+// Switch between cached and live rotation at runtime (benchmarks, debugging)
+void sprite_cache_set_enabled(bool enabled);
+bool sprite_cache_enabled(void);
+
+size_t sprite_cache_used_bytes(void);
+
+/**
+ * @brief Shows one layer rotated by 'angle' about (pivot_x, pivot_y) with the
+ *        un-rotated image's top-left corner at (x, y). Uses the cache when
+ *        the layer has one, live lv_img rotation otherwise. Layers of a
+ *        composited stack only hand their pose to the compositor.
+ *
+ * @param angle    LVGL decidegrees, any value (wrapped internally)
+ * @param pivot_x  pivot relative to the original image
+ */
+void sprite_layer_present(pivot_sprite_t *layer, int32_t angle,
+                          lv_coord_t pivot_x, lv_coord_t pivot_y,
+                          lv_coord_t x, lv_coord_t y);
+
+/**
+ * @brief Runs 'frames' full refreshes of a stack animation with the cache on
+ *        and off and prints ms/frame for each over Serial. Prints a note
+ *        instead if none of the stack's layers has a cache.
+ */
+void sprite_cache_benchmark(pivot_sprite_t *sprites, uint16_t sprite_count,
+                            sprite_exec_cb_t exec_cb, uint16_t frames);
+
+#endif // SPRITE_CACHE_H
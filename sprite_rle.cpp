@@ -0,0 +1,66 @@
+#include "sprite_rle.h"
+#include "mem_plan.h"
+
+#define PX_SIZE LV_IMG_PX_SIZE_ALPHA_BYTE   // 2 color bytes + 1 alpha byte
+
+static uint8_t *const scratch = (uint8_t *)MEM_ARENA(MEM_ARENA_SPRITE_RLE);
+
+//----------------------- Decoding ------------------------
+
+bool sprite_rle_is(const lv_img_dsc_t *img)
+{
+#if LVGL_VERSION_MAJOR == 8
+    return img->header.cf == SPRITE_RLE_CF && img->data &&
+           ((const sprite_rle_t *)img->data)->magic == SPRITE_RLE_MAGIC;
+#else
+    (void)img;
+    return false;
+#endif
+}
+
+void sprite_rle_decode_row(const lv_img_dsc_t *img, lv_coord_t y, lv_coord_t x,
+                           lv_coord_t len, uint8_t *dst)
+{
+    const sprite_rle_t *rle = (const sprite_rle_t *)img->data;
+    const uint8_t      *run = rle->runs + rle->rows[y];
+    lv_coord_t          end = x + len;
+    lv_coord_t          pos = 0;
+
+    memset(dst, 0, (size_t)len * PX_SIZE);
+
+    // Runs add up to the row width, so this stops at the row's end at the latest
+    while (pos < end) {
+        pos += run[0];
+        uint8_t        count = run[1];
+        const uint8_t *index = run + 2;
+        run = index + count;
+
+        lv_coord_t from = LV_MAX(pos, x);
+        lv_coord_t to   = LV_MIN(pos + count, end);
+        uint8_t   *out  = dst + (size_t)(from - x) * PX_SIZE;
+        for (lv_coord_t i = from; i < to; i++) {
+            const uint8_t *px = rle->palette + (size_t)index[i - pos] * PX_SIZE;
+            out[0] = px[0];
+            out[1] = px[1];
+            out[2] = px[2];
+            out += PX_SIZE;
+        }
+        pos += count;
+    }
+}
+
+const uint8_t *sprite_rle_unpack(const lv_img_dsc_t *img, lv_coord_t y1, lv_coord_t y2)
+{
+    lv_coord_t w = img->header.w;
+    if (y1 < 0 || y2 >= (lv_coord_t)img->header.h || y1 > y2 ||
+        (size_t)w * (y2 - y1 + 1) * PX_SIZE > SPRITE_RLE_SCRATCH_BYTES) {
+        return NULL;
+    }
+
+    uint8_t *row = scratch;
+    for (lv_coord_t y = y1; y <= y2; y++) {
+        sprite_rle_decode_row(img, y, 0, w, row);
+        row += (size_t)w * PX_SIZE;
+    }
+    return scratch;
+}
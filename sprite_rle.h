@@ -0,0 +1,91 @@
+#ifndef SPRITE_RLE_H
+#define SPRITE_RLE_H
+
+#include <lvgl.h>
+
+/*
+   Compressed sprite layers: a small palette plus per-row runs.
+
+   Raw TRUE_COLOR_ALPHA layers spend 3 bytes on every pixel, and most of a
+   sprite-stack slice is fully transparent. Here each row is a list of
+   (skip, count, count palette indices) runs: 'skip' transparent pixels, then
+   'count' pixels looked up in a palette of TRUE_COLOR_ALPHA entries. A row's
+   runs always add up to the image width, and a table of row offsets lets any
+   row be decoded on its own. Fully transparent pixels are stored as all-zero
+   bytes, the same as the raw arrays, so a decoded layer matches the raw one
+   byte for byte.
+
+   The asset headers (pizza_rle.h, ...) come from host/sprite_rle_convert and
+   keep the raw headers' descriptor names, so the sketch picks one set or the
+   other at include time (SPRITE_RLE_ASSETS).
+
+   Composited stacks unpack the rows of a layer they are about to sample into
+   one shared scratch right before it is rotated (sprite_rle_unpack()). A
+   rotated layer is sampled along slanted lines, so every row in the range is
+   read many times; decoding each one once beats re-decoding it per
+   destination row. Anything else shown through an lv_img gets
+   its rows from the LVGL decoder, one line at a time into the draw buffer;
+   LVGL v8 draws line-decoded images unrotated, so rotating layers need the
+   compositor. LVGL v8 only.
+*/
+
+#if LVGL_VERSION_MAJOR == 8
+#define SPRITE_RLE_CF     LV_IMG_CF_USER_ENCODED_0
+#endif
+#define SPRITE_RLE_MAGIC  0x31454C52UL       // "RLE1"
+
+#ifndef SPRITE_RLE_ASSETS
+#if LVGL_VERSION_MAJOR == 8
+#define SPRITE_RLE_ASSETS 1
+#else
+#define SPRITE_RLE_ASSETS 0
+#endif
+#endif
+
+/*
+  Largest layer sprite_rle_unpack() takes: the biggest one among the encoded
+  assets (the 32x32 bed). Every generated header defines its own
+  <NAME>_RLE_MAX_LAYER_BYTES and fails the build if it outgrows this.
+*/
+#ifndef SPRITE_RLE_MAX_LAYER_BYTES
+#define SPRITE_RLE_MAX_LAYER_BYTES (32 * 32 * LV_IMG_PX_SIZE_ALPHA_BYTE)
+#endif
+#if SPRITE_RLE_ASSETS
+#define SPRITE_RLE_SCRATCH_BYTES SPRITE_RLE_MAX_LAYER_BYTES
+#else
+#define SPRITE_RLE_SCRATCH_BYTES 0
+#endif
+
+// What lv_img_dsc_t.data points at for a SPRITE_RLE_CF image
+typedef struct {
+    uint32_t        magic;             // SPRITE_RLE_MAGIC
+    uint16_t        palette_count;
+    const uint8_t  *palette;           // palette_count TRUE_COLOR_ALPHA pixels
+    const uint16_t *rows;              // per row, where its runs start in 'runs'
+    const uint8_t  *runs;
+} sprite_rle_t;
+
+/**
+ * @brief Registers the LVGL image decoder for SPRITE_RLE_CF images. Call
+ *        after lv_init() and before the first such image is shown.
+ */
+void sprite_rle_init(void);
+
+bool sprite_rle_is(const lv_img_dsc_t *img);
+
+/**
+ * @brief Decodes pixels x .. x+len-1 of row y as TRUE_COLOR_ALPHA into 'dst'.
+ *        Transparent pixels come out as zeros.
+ */
+void sprite_rle_decode_row(const lv_img_dsc_t *img, lv_coord_t y, lv_coord_t x,
+                           lv_coord_t len, uint8_t *dst);
+
+/**
+ * @brief Decodes rows y1 .. y2 (inclusive, full width) into the shared scratch.
+ *
+ * @return the TRUE_COLOR_ALPHA pixels with row y1 first, valid until the next
+ *         call; NULL if the rows don't fit SPRITE_RLE_SCRATCH_BYTES
+ */
+const uint8_t *sprite_rle_unpack(const lv_img_dsc_t *img, lv_coord_t y1, lv_coord_t y2);
+
+#endif // SPRITE_RLE_H
@@ -0,0 +1,60 @@
+#include "sprite_rle.h"
+
+/*
+  LVGL's side of sprite_rle.h, apart from the decoding itself so the host
+  bench can decode without linking LVGL.
+*/
+
+//----------------------- LVGL decoder ------------------------
+
+#if LVGL_VERSION_MAJOR == 8
+static lv_res_t decoder_info(lv_img_decoder_t *decoder, const void *src, lv_img_header_t *header)
+{
+    if (lv_img_src_get_type(src) != LV_IMG_SRC_VARIABLE || !sprite_rle_is((const lv_img_dsc_t *)src)) {
+        return LV_RES_INV;
+    }
+
+    // LVGL blends what read_line hands out as plain TRUE_COLOR_ALPHA
+    const lv_img_dsc_t *img = (const lv_img_dsc_t *)src;
+    header->cf          = LV_IMG_CF_TRUE_COLOR_ALPHA;
+    header->always_zero = 0;
+    header->w           = img->header.w;
+    header->h           = img->header.h;
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_open(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+    if (dsc->src_type != LV_IMG_SRC_VARIABLE || !sprite_rle_is((const lv_img_dsc_t *)dsc->src)) {
+        return LV_RES_INV;
+    }
+    dsc->img_data = NULL;   // no whole image, LVGL asks for lines instead
+    return LV_RES_OK;
+}
+
+static lv_res_t decoder_read_line(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc,
+                                  lv_coord_t x, lv_coord_t y, lv_coord_t len, uint8_t *buf)
+{
+    sprite_rle_decode_row((const lv_img_dsc_t *)dsc->src, y, x, len, buf);
+    return LV_RES_OK;
+}
+
+static void decoder_close(lv_img_decoder_t *decoder, lv_img_decoder_dsc_t *dsc)
+{
+}
+#endif
+
+void sprite_rle_init(void)
+{
+#if LVGL_VERSION_MAJOR == 8
+    static lv_img_decoder_t *decoder = NULL;
+    if (decoder) {
+        return;
+    }
+    decoder = lv_img_decoder_create();
+    lv_img_decoder_set_info_cb(decoder, decoder_info);
+    lv_img_decoder_set_open_cb(decoder, decoder_open);
+    lv_img_decoder_set_read_line_cb(decoder, decoder_read_line);
+    lv_img_decoder_set_close_cb(decoder, decoder_close);
+#endif
+}
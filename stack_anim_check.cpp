@@ -0,0 +1,79 @@
+#include "stack_anim_check.h"
+#include "stack_compositor.h"
+
+static pivot_sprite_t per_layer[STACK_ANIM_MAX_LAYERS];
+static pivot_sprite_t driven[STACK_ANIM_MAX_LAYERS];
+static sprite_stack_t per_layer_poses;
+static sprite_stack_t driven_poses;
+
+// Layer copies that hand their poses to a recorder instead of an object
+static void make_copy(pivot_sprite_t *copy, sprite_stack_t *recorder,
+                      const pivot_sprite_t *sprites, uint16_t count)
+{
+    memset(recorder, 0, sizeof(*recorder));
+    recorder->layers = copy;
+    recorder->count  = count;
+    for (uint16_t i = 0; i < count; i++) {
+        copy[i]       = sprites[i];
+        copy[i].obj   = NULL;
+        copy[i].cache = NULL;
+        copy[i].stack = recorder;
+    }
+}
+
+// What stack_anim() did before the driver
+static void start_per_layer(pivot_sprite_t *sprites, uint16_t count, int32_t start_angle,
+                            int32_t end_angle, sprite_exec_cb_t exec_cb)
+{
+    for (uint16_t i = 0; i < count; i++) {
+        lv_anim_t anim;
+        lv_anim_init(&anim);
+        lv_anim_set_var(&anim, &sprites[i]);
+        lv_anim_set_exec_cb(&anim, exec_cb);
+        lv_anim_set_time(&anim, STACK_ANIM_CHECK_MS);
+        lv_anim_set_values(&anim, start_angle, end_angle);
+        lv_anim_start(&anim);
+    }
+}
+
+static bool check_one(const char *name, sprite_exec_cb_t exec_cb,
+                      const pivot_sprite_t *sprites, uint16_t count)
+{
+    make_copy(per_layer, &per_layer_poses, sprites, count);
+    make_copy(driven, &driven_poses, sprites, count);
+
+    // Started back to back, so both are advanced by the same anim timer passes
+    int32_t angle = 0;
+    start_per_layer(per_layer, count, angle, angle + 3600, exec_cb);
+    stack_anim(driven, count, &angle, 3600, STACK_ANIM_CHECK_MS, false, exec_cb);
+
+    uint32_t passes = 0, differed = 0;
+    uint32_t end_ms = millis() + STACK_ANIM_CHECK_MS + 100;
+    while ((int32_t)(millis() - end_ms) < 0) {
+        lv_timer_handler();
+        passes++;
+        differed += memcmp(per_layer_poses.poses, driven_poses.poses,
+                           count * sizeof(stack_layer_pose_t)) != 0;
+        delay(5);
+    }
+
+    Serial.print(name);
+    Serial.print(",");
+    Serial.print(passes);
+    Serial.print(",");
+    Serial.print(differed);
+    Serial.println(differed == 0 ? ",pass" : ",FAIL");
+    return differed == 0;
+}
+
+uint8_t stack_anim_check_run(const pivot_sprite_t *sprites, uint16_t sprite_count)
+{
+    uint16_t count = LV_MIN(sprite_count, STACK_ANIM_MAX_LAYERS);
+    uint8_t  failed = 0;
+
+    Serial.println("callback,passes,differed,result");
+    failed += !check_one("pet_anim",    pet_anim,    sprites, count);
+    failed += !check_one("item_anim",   item_anim,   sprites, count);
+    failed += !check_one("rotate_anim", rotate_anim, sprites, count);
+    return failed;
+}
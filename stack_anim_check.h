@@ -0,0 +1,26 @@
+#ifndef STACK_ANIM_CHECK_H
+#define STACK_ANIM_CHECK_H
+
+#include "animations.h"
+
+// Replays the sketch's own stacks through LVGL's animation timer; 1 runs
+// it from setup() once the dino layers exist.
+#ifndef STACK_ANIM_CHECK
+#define STACK_ANIM_CHECK 0
+#endif
+
+#define STACK_ANIM_CHECK_MS 600       // animation length per layer callback
+
+/**
+ * @brief Plays pet_anim, item_anim and rotate_anim over a copy of 'sprites'
+ *        twice at once: with one lv_anim per layer, the way stack_anim() used
+ *        to, and through the per-stack driver. Neither copy touches the
+ *        screen; every layer's pose is recorded instead and the two are
+ *        compared after each lv_timer_handler() pass. Prints callback,
+ *        passes, passes that differed and pass/fail as CSV over Serial.
+ *
+ * @return number of callbacks whose poses differed
+ */
+uint8_t stack_anim_check_run(const pivot_sprite_t *sprites, uint16_t sprite_count);
+
+#endif // STACK_ANIM_CHECK_H
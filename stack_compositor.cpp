@@ -0,0 +1,331 @@
+#include "stack_compositor.h"
+#include "mem_plan.h"
+#include "profiler.h"
+#include "sprite_rle.h"
+
+#if LV_COLOR_DEPTH != 16
+#error "stack_compositor expects LV_COLOR_DEPTH 16 (RGB565 + A8 layers)"
+#endif
+
+#define PX_SIZE  LV_IMG_PX_SIZE_ALPHA_BYTE   // layer pixel: 2 color bytes + 1 alpha byte
+#define OUT_SIZE sizeof(lv_color_t)          // stack pixel: RGB565, LV_COLOR_CHROMA_KEY is clear
+
+static sprite_stack_t *stacks[STACK_COMP_MAX_STACKS];
+static uint8_t         stack_count = 0;
+static lv_timer_t     *comp_timer  = NULL;
+static size_t          pool_used   = 0;
+
+//----------------------- Pixel helpers ------------------------
+
+// One layer pixel over the stack; layers are all-or-nothing (layer_keyable())
+static inline void put_px(uint8_t *dst, const uint8_t *src)
+{
+    if (src[2] != LV_OPA_TRANSP) {
+        dst[0] = src[0];
+        dst[1] = src[1];
+    }
+}
+
+// Whether a layer survives the chroma-keyed buffer unchanged: every pixel
+// fully clear or fully opaque, and no opaque one the key colour
+static bool layer_keyable(const lv_img_dsc_t *src)
+{
+    const uint8_t *px;
+    size_t         n;
+    if (sprite_rle_is(src)) {
+        // Decoded pixels all come from the palette
+        const sprite_rle_t *rle = (const sprite_rle_t *)src->data;
+        px = rle->palette;
+        n  = rle->palette_count;
+    } else {
+        px = src->data;
+        n  = (size_t)src->header.w * src->header.h;
+    }
+
+    lv_color_t key = LV_COLOR_CHROMA_KEY;
+    for (size_t i = 0; i < n; i++, px += PX_SIZE) {
+        if (px[2] == LV_OPA_TRANSP) {
+            continue;
+        }
+        if (px[2] != LV_OPA_COVER || memcmp(px, &key, sizeof(key)) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Q15 sin/cos of a decidegree angle, interpolated like LVGL's own transform
+static void sin_cos_q15(int32_t angle, int32_t *s, int32_t *c)
+{
+    int32_t deg = angle / 10;
+    int32_t rem = angle % 10;
+
+    int32_t s0 = lv_trigo_sin(deg), s1 = lv_trigo_sin(deg + 1);
+    int32_t c0 = lv_trigo_cos(deg), c1 = lv_trigo_cos(deg + 1);
+    *s = s0 + ((s1 - s0) * rem) / 10;
+    *c = c0 + ((c1 - c0) * rem) / 10;
+}
+
+// Screen area a layer covers once rotated
+static void layer_area(const pivot_sprite_t *layer, const stack_layer_pose_t *pose, lv_area_t *area)
+{
+    lv_point_t pivot = {pose->pivot_x, pose->pivot_y};
+    _lv_img_buf_get_transformed_area(area, layer->src->header.w, layer->src->header.h,
+                                     pose->angle, LV_IMG_ZOOM_NONE, &pivot);
+    lv_area_move(area, pose->x, pose->y);
+}
+
+//----------------------- Compositing ------------------------
+
+// Rotates one layer into the stack buffer, visiting only the pixels it covers
+static void draw_layer(sprite_stack_t *stack, uint16_t i, const lv_area_t *bounds)
+{
+    const pivot_sprite_t     *layer = &stack->layers[i];
+    const stack_layer_pose_t *pose  = &stack->poses[i];
+    lv_coord_t                src_w = layer->src->header.w;
+    lv_coord_t                src_h = layer->src->header.h;
+    lv_coord_t                dst_w = lv_area_get_width(bounds);
+
+    lv_area_t area;
+    layer_area(layer, pose, &area);
+    if (!_lv_area_intersect(&area, &area, bounds)) {
+        return;
+    }
+
+    int32_t s, c;
+    sin_cos_q15(pose->angle, &s, &c);
+
+    // Inverse-map every destination pixel centre back into the layer. Offsets
+    // are kept in half pixels, so (q * offset) >> 16 lands on whole pixels.
+    lv_coord_t px = pose->x + pose->pivot_x;
+    lv_coord_t py = pose->y + pose->pivot_y;
+
+    // Layer rows the clipped area reaches. The map is affine, so they come
+    // from its corners; a stack cut off at the bottom skips the rest.
+    lv_coord_t row1 = src_h - 1, row2 = 0;
+    for (int corner = 0; corner < 4; corner++) {
+        int32_t u2 = 2 * ((corner & 1 ? area.x2 : area.x1) - px) + 1;
+        int32_t v2 = 2 * ((corner & 2 ? area.y2 : area.y1) - py) + 1;
+        int32_t sy = ((c * v2 - s * u2) >> 16) + pose->pivot_y;
+        row1 = LV_MIN(row1, (lv_coord_t)LV_MAX(sy, 0));
+        row2 = LV_MAX(row2, (lv_coord_t)LV_MIN(sy, src_h - 1));
+    }
+    if (row1 > row2) {
+        return;
+    }
+
+    // Compressed layers have just those rows unpacked into the shared scratch;
+    // either way 'src' starts at row1
+    const uint8_t *src;
+    if (sprite_rle_is(layer->src)) {
+        src = sprite_rle_unpack(layer->src, row1, row2);
+        if (!src) {
+            return;
+        }
+    } else {
+        src = layer->src->data + (size_t)row1 * src_w * PX_SIZE;
+    }
+
+    for (lv_coord_t y = area.y1; y <= area.y2; y++) {
+        int32_t v2 = 2 * (y - py) + 1;
+        int32_t u2 = 2 * (area.x1 - px) + 1;
+        int32_t sx_q = c * u2 + s * v2;
+        int32_t sy_q = c * v2 - s * u2;
+
+        uint8_t *dst = stack->buf + ((size_t)(y - bounds->y1) * dst_w + (area.x1 - bounds->x1)) * OUT_SIZE;
+        for (lv_coord_t x = area.x1; x <= area.x2; x++) {
+            int32_t sx = (sx_q >> 16) + pose->pivot_x;
+            int32_t sy = (sy_q >> 16) + pose->pivot_y;
+            if (sx >= 0 && sx < src_w && sy >= row1 && sy <= row2) {
+                put_px(dst, src + ((size_t)(sy - row1) * src_w + sx) * PX_SIZE);
+            }
+            sx_q += 2 * c;
+            sy_q -= 2 * s;
+            dst  += OUT_SIZE;
+        }
+    }
+}
+
+void sprite_stack_compose(sprite_stack_t *stack)
+{
+    if (!stack->dirty) {
+        return;
+    }
+    stack->dirty = false;
+
+    PROF_SCOPE(PROF_COMPOSE);
+
+    // 1) Bounds of the whole stack at its current poses
+    lv_area_t bounds;
+    layer_area(&stack->layers[0], &stack->poses[0], &bounds);
+    for (uint16_t i = 1; i < stack->count; i++) {
+        lv_area_t area;
+        layer_area(&stack->layers[i], &stack->poses[i], &area);
+        _lv_area_join(&bounds, &bounds, &area);
+    }
+
+    lv_coord_t w = lv_area_get_width(&bounds);
+    lv_coord_t h = lv_area_get_height(&bounds);
+    size_t     needed = (size_t)w * h * OUT_SIZE;
+
+    // 2) Sized for the worst pose; one outside what init allowed for loses
+    //    its bottom rows rather than growing the buffer
+    if (needed > stack->buf_size) {
+        h = stack->buf_size / ((size_t)w * OUT_SIZE);
+        bounds.y2 = bounds.y1 + h - 1;
+        needed = (size_t)w * h * OUT_SIZE;
+    }
+
+    // 3) Bottom layer first, each one drawn over the ones below
+    lv_color_fill((lv_color_t *)stack->buf, LV_COLOR_CHROMA_KEY, (uint32_t)w * h);
+    for (uint16_t i = 0; i < stack->count; i++) {
+        draw_layer(stack, i, &bounds);
+    }
+
+    // The image cache keys on the descriptor, which keeps its address
+    lv_img_cache_invalidate_src(&stack->image);
+    stack->image.header.w  = w;
+    stack->image.header.h  = h;
+    stack->image.data_size = needed;
+    stack->image.data      = stack->buf;
+
+    // One invalidation covering where the image was and where it is now
+    stack_inval_t inval;
+    stack_inval_begin(&inval);
+    stack_inval_add(&inval, stack->obj);
+    lv_img_set_src(stack->obj, &stack->image);
+    lv_obj_set_pos(stack->obj, bounds.x1, bounds.y1);
+    stack_inval_layout(stack->obj);
+    stack_inval_add(&inval, stack->obj);
+    stack_inval_end(&inval);
+#if !STACK_ANIM_UNION_INVALIDATE
+    lv_obj_invalidate(stack->obj);   // same source and place, new pixels
+#endif
+
+    stack->composites++;
+}
+
+//----------------------- Setup / poses ------------------------
+
+// Farthest any pixel of a w x h layer gets from a pivot near its centre
+static lv_coord_t swept_radius(lv_coord_t w, lv_coord_t h)
+{
+    uint32_t dx = w - w / 2;
+    uint32_t dy = h - h / 2;
+    uint32_t d2 = dx * dx + dy * dy;
+    lv_coord_t r = 0;
+    while ((uint32_t)r * r < d2) {
+        r++;
+    }
+    // One more for LVGL's rounding of the transformed area
+    return r + STACK_COMP_PIVOT_SLACK + 1;
+}
+
+// Bytes of the buffer that fits the stack at any angle
+static size_t worst_case_bytes(const pivot_sprite_t *layers, uint16_t count, lv_coord_t lift)
+{
+    lv_coord_t r = 0;
+    for (uint16_t i = 0; i < count; i++) {
+        r = LV_MAX(r, swept_radius(layers[i].src->header.w, layers[i].src->header.h));
+    }
+    // Every layer turns about the same column; the pivots spread over 'lift' rows
+    size_t side = 2 * (size_t)r + 1;
+    return side * (side + lift) * OUT_SIZE;
+}
+
+bool sprite_stack_init(sprite_stack_t *stack, pivot_sprite_t *layers, uint16_t count,
+                       lv_coord_t lift)
+{
+    if (count == 0 || count > STACK_COMP_MAX_LAYERS || stack_count >= STACK_COMP_MAX_STACKS) {
+        return false;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        const lv_img_dsc_t *src = layers[i].src;
+        bool raw = src->header.cf == LV_IMG_CF_TRUE_COLOR_ALPHA;
+        bool rle = sprite_rle_is(src) &&
+                   (size_t)src->header.w * src->header.h * PX_SIZE <= SPRITE_RLE_SCRATCH_BYTES;
+        if ((!raw && !rle) || !layer_keyable(src) ||
+            lv_img_get_zoom(layers[i].obj) != LV_IMG_ZOOM_NONE) {
+            return false;
+        }
+    }
+
+    // Word-aligned slices of the pool, never given back
+    size_t bytes = (worst_case_bytes(layers, count, LV_MAX(lift, 0)) + 3) & ~(size_t)3;
+    if (pool_used + bytes > MEM_ARENA_BYTES(MEM_ARENA_STACK_COMP)) {
+        return false;
+    }
+
+    memset(stack, 0, sizeof(*stack));
+    stack->layers   = layers;
+    stack->count    = count;
+    stack->buf      = (uint8_t *)MEM_ARENA(MEM_ARENA_STACK_COMP) + pool_used;
+    stack->buf_size = bytes;
+    stack->image.header.cf = LV_IMG_CF_TRUE_COLOR_CHROMA_KEYED;
+    pool_used += bytes;
+
+    // Same z position as the layers it replaces
+    stack->obj = lv_img_create(lv_obj_get_parent(layers[0].obj));
+    lv_obj_move_to_index(stack->obj, lv_obj_get_index(layers[0].obj));
+
+    for (uint16_t i = 0; i < count; i++) {
+        stack_layer_pose_t *pose = &stack->poses[i];
+        pose->angle   = 0;
+        pose->pivot_x = layers[i].src->header.w / 2;
+        pose->pivot_y = layers[i].src->header.h / 2;
+        pose->x       = lv_obj_get_x(layers[i].obj);
+        pose->y       = lv_obj_get_y(layers[i].obj);
+
+        lv_obj_add_flag(layers[i].obj, LV_OBJ_FLAG_HIDDEN);
+        layers[i].stack = stack;
+    }
+
+    stack->dirty = true;
+    sprite_stack_compose(stack);
+
+    stacks[stack_count++] = stack;
+    return true;
+}
+
+void sprite_stack_set_pose(sprite_stack_t *stack, uint16_t layer_index, int32_t angle,
+                           lv_coord_t pivot_x, lv_coord_t pivot_y,
+                           lv_coord_t x, lv_coord_t y)
+{
+    if (layer_index >= stack->count) {
+        return;
+    }
+
+    stack_layer_pose_t *pose = &stack->poses[layer_index];
+    if (pose->angle == angle && pose->pivot_x == pivot_x && pose->pivot_y == pivot_y &&
+        pose->x == x && pose->y == y) {
+        return;
+    }
+
+    pose->angle   = (int16_t)angle;
+    pose->pivot_x = pivot_x;
+    pose->pivot_y = pivot_y;
+    pose->x       = x;
+    pose->y       = y;
+    stack->dirty  = true;
+}
+
+static void compositor_timer_cb(lv_timer_t *timer)
+{
+    for (uint8_t i = 0; i < stack_count; i++) {
+        sprite_stack_compose(stacks[i]);
+    }
+}
+
+void stack_compositor_start(void)
+{
+    // lv_timer_create() puts new timers at the head of the list, so this one
+    // runs before the display refresh of the same lv_timer_handler() pass
+    if (!comp_timer) {
+        comp_timer = lv_timer_create(compositor_timer_cb, 1, NULL);
+    }
+}
+
+size_t stack_compositor_pool_used(void)
+{
+    return pool_used;
+}
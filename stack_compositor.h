@@ -0,0 +1,109 @@
+#ifndef STACK_COMPOSITOR_H
+#define STACK_COMPOSITOR_H
+
+#include <lvgl.h>
+#include "animations.h"
+
+/*
+   Sprite-stack compositor.
+
+   Instead of one lv_img per layer (15 for the dino, 35 on screen in total)
+   a composited stack keeps its layer objects hidden and shows a single
+   lv_img whose buffer holds every layer already rotated and drawn bottom to
+   top. The exec callbacks only record each layer's pose
+   (sprite_layer_present() -> sprite_stack_set_pose()); the stack is redrawn
+   at most once per lv_timer_handler() pass, and only if a pose changed.
+
+   Layers are sampled nearest-neighbour, which keeps the pixel art crisp.
+   Needs LV_COLOR_DEPTH 16 and layers at 1:1 zoom, either raw
+   TRUE_COLOR_ALPHA or compressed (sprite_rle.h).
+
+   The buffer is TRUE_COLOR_CHROMA_KEYED, 2 bytes a pixel instead of 3:
+   LV_COLOR_CHROMA_KEY marks what's clear. That is exact only for layers
+   whose pixels are fully clear or fully opaque and never the key colour,
+   as in the sketch's sprites; a stack with any other layer isn't composited.
+*/
+
+// 0 leaves every stack on its per-layer objects, e.g. to compare against
+// the rotation cache (sprite_cache.h, SPRITE_CACHE 1)
+#ifndef STACK_COMPOSITOR
+#define STACK_COMPOSITOR 1
+#endif
+
+#define STACK_COMP_MAX_LAYERS 20      // same limit as stack_anim()
+#define STACK_COMP_MAX_STACKS 8
+
+// Rows a layer's pivot may sit off its centre (pet_anim's bob is index / 4)
+#define STACK_COMP_PIVOT_SLACK 4
+
+/*
+  Every stack's buffer is sized for its worst pose once, in sprite_stack_init(),
+  and carved from this pool (MEM_ARENA_STACK_COMP); nothing is allocated while
+  animating. The sketch's four stacks take ~43.5 KB, most of it the dino's
+  103x140 swept area; "Composited stacks" at boot prints what they used.
+*/
+#ifndef STACK_COMP_POOL_BYTES
+#if STACK_COMPOSITOR
+#define STACK_COMP_POOL_BYTES (44UL * 1024)
+#else
+#define STACK_COMP_POOL_BYTES 0UL
+#endif
+#endif
+
+typedef struct {
+    int16_t    angle;                 // LVGL decidegrees, 0..3599
+    lv_coord_t pivot_x;               // relative to the un-rotated layer
+    lv_coord_t pivot_y;
+    lv_coord_t x;                     // un-rotated top-left on screen
+    lv_coord_t y;
+} stack_layer_pose_t;
+
+typedef struct sprite_stack_t {
+    pivot_sprite_t     *layers;
+    uint16_t            count;
+
+    lv_obj_t           *obj;          // the one object that is drawn
+    lv_img_dsc_t        image;        // points into buf, resized to the stack's bounds
+    uint8_t            *buf;          // in the pool, sized for the worst pose
+    size_t              buf_size;
+
+    stack_layer_pose_t  poses[STACK_COMP_MAX_LAYERS];
+    bool                dirty;
+    uint32_t            composites;   // how often the buffer was redrawn
+} sprite_stack_t;
+
+/**
+ * @brief Takes over drawing for a stack made by create_sprites_pseudo_3d():
+ *        hides the layer objects and puts one composited image at the z
+ *        position of the bottom layer.
+ *
+ *        The buffer covers the largest layer turned to any angle about a
+ *        pivot within STACK_COMP_PIVOT_SLACK of its centre, 'lift' rows
+ *        taller (stack_anim_lift() of the animations the stack runs). A pose
+ *        that still doesn't fit loses its bottom rows.
+ *
+ * @return false (stack stays on per-layer objects) if it can't be composited,
+ *         a layer has partial alpha or the key colour, or the pool has no
+ *         room for it
+ */
+bool sprite_stack_init(sprite_stack_t *stack, pivot_sprite_t *layers, uint16_t count,
+                       lv_coord_t lift);
+
+// Records where one layer should be drawn; marks the stack dirty on change
+void sprite_stack_set_pose(sprite_stack_t *stack, uint16_t layer_index, int32_t angle,
+                           lv_coord_t pivot_x, lv_coord_t pivot_y,
+                           lv_coord_t x, lv_coord_t y);
+
+// Redraws the stack's buffer now if any pose changed since the last call
+void sprite_stack_compose(sprite_stack_t *stack);
+
+/**
+ * @brief Creates the timer that composes every dirty stack. Call after
+ *        lv_xiao_disp_init() so it runs ahead of the display refresh.
+ */
+void stack_compositor_start(void);
+
+// Bytes of STACK_COMP_POOL_BYTES the stacks so far have taken
+size_t stack_compositor_pool_used(void);
+
+#endif // STACK_COMPOSITOR_H
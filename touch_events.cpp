@@ -0,0 +1,242 @@
+#include "touch_events.h"
+#include "lv_xiao_round_screen.h"
+#include "event_log.h"
+
+// Written by the ISR only
+static volatile uint32_t isr_reports  = 0;
+static volatile uint32_t isr_ms       = 0;   // latest report
+
+// Producer state (touch_events_service)
+static uint32_t serviced = 0;           // isr_reports already handled
+static uint32_t last_read_ms = 0;
+static uint32_t last_seen_ms = 0;       // last report that carried a point
+static bool     prod_down    = false;
+static lv_coord_t prod_x = 0, prod_y = 0;
+
+// FIFO between the producer, polled many times per pass (display flush,
+// touch_events_wait()), and the consumer once per pass. Both run in loop()'s
+// context; only the report counters above are shared with the ISR.
+static touch_event_t ring[TOUCH_QUEUE_LEN];
+static uint16_t      ring_head = 0;   // next slot to write (producer)
+static uint16_t      ring_tail = 0;   // next slot to read (consumer)
+
+// Consumer state (touch_events_update)
+static touch_state_t state;
+static touch_event_t frame_events[TOUCH_QUEUE_LEN];
+static uint8_t       frame_count = 0;
+
+static touch_events_stats_t stats;
+static bool trace = false;
+
+//----------------------- Ring ------------------------
+
+static void ring_push(uint8_t type, uint32_t ms, lv_coord_t x, lv_coord_t y)
+{
+    uint16_t head = ring_head;
+    if ((uint16_t)(head - ring_tail) >= TOUCH_QUEUE_LEN) {
+        // Keep the older events, a DOWN without its UP is worse than a stale MOVE
+        stats.dropped++;
+        return;
+    }
+
+    touch_event_t *ev = &ring[head & (TOUCH_QUEUE_LEN - 1)];
+    ev->ms   = ms;
+    ev->x    = x;
+    ev->y    = y;
+    ev->type = type;
+    ring_head = head + 1;
+    stats.events++;
+}
+
+bool touch_events_pop(touch_event_t *event)
+{
+    uint16_t tail = ring_tail;
+    if (tail == ring_head) {
+        return false;
+    }
+    *event    = ring[tail & (TOUCH_QUEUE_LEN - 1)];
+    ring_tail = tail + 1;
+    return true;
+}
+
+//----------------------- Producer ------------------------
+
+void touch_events_isr(void)
+{
+    isr_ms = millis();
+    isr_reports = isr_reports + 1;
+}
+
+void touch_events_service(void)
+{
+    uint32_t now = millis();
+
+    // One consistent snapshot; an edge between two separate reads would pair
+    // one report's count with another's time
+    noInterrupts();
+    uint32_t reports = isr_reports;
+    uint32_t stamp   = isr_ms;
+    uint32_t pending = reports - serviced;
+    serviced = reports;
+    interrupts();
+
+    bool due = (pending != 0);
+    if (due) {
+        stats.reports += pending;
+        // A read only returns the current point; the ones in between are gone
+        stats.coalesced += pending - 1;
+    } else if (prod_down && chsc6x_int_active() && now - last_read_ms >= TOUCH_HOLD_READ_MS) {
+        // Some firmware keeps INT low for the whole contact instead of pulsing it
+        due   = true;
+        stamp = now;
+    }
+
+    if (due) {
+        lv_coord_t x, y;
+        bool touched;
+        stats.reads++;
+        last_read_ms = now;
+        if (!chsc6x_read_point(&x, &y, &touched)) {
+            stats.read_errors++;
+            return;
+        }
+
+        if (touched) {
+            x = constrain(x, 0, SCREEN_WIDTH - 1);
+            y = constrain(y, 0, SCREEN_HEIGHT - 1);
+            last_seen_ms = stamp;
+            if (!prod_down) {
+                ring_push(TOUCH_EV_DOWN, stamp, x, y);
+            } else if (x != prod_x || y != prod_y) {
+                ring_push(TOUCH_EV_MOVE, stamp, x, y);
+            }
+            prod_down = true;
+            prod_x = x;
+            prod_y = y;
+        } else if (prod_down) {
+            ring_push(TOUCH_EV_UP, stamp, prod_x, prod_y);
+            prod_down = false;
+        } else if (pending >= 2) {
+            // The report that had the finger and the one that found it gone,
+            // both before this read: a tap that fit inside a long render.
+            // Its point was never read, and the last one reported belongs to
+            // an earlier contact, so nothing is queued for it.
+            stats.unseen++;
+        }
+        return;
+    }
+
+    // The controller doesn't always send a final "no touch" report
+    if (prod_down && !chsc6x_int_active() && now - last_seen_ms >= TOUCH_RELEASE_MS) {
+        ring_push(TOUCH_EV_UP, now, prod_x, prod_y);
+        prod_down = false;
+    }
+}
+
+void touch_events_wait(uint32_t ms)
+{
+    uint32_t start = millis();
+    while (millis() - start < ms) {
+        touch_events_service();
+        delay(1);
+    }
+}
+
+//----------------------- Consumer ------------------------
+
+void touch_events_update(void)
+{
+    touch_events_service();
+
+    frame_count   = 0;
+    state.touched = state.down;
+
+    touch_event_t ev;
+    while (touch_events_pop(&ev)) {
+        frame_events[frame_count++] = ev;
+        LOG_DEBUG(LOG_EV_TOUCH, ev.type, ev.x, ev.y);
+
+        state.x       = ev.x;
+        state.y       = ev.y;
+        state.last_ms = ev.ms;
+        if (ev.type == TOUCH_EV_DOWN) {
+            state.down    = true;
+            state.touched = true;
+            state.down_ms = ev.ms;
+        } else if (ev.type == TOUCH_EV_UP) {
+            state.down = false;
+        }
+
+        if (trace) {
+            Serial.print(ev.ms);
+            Serial.print(ev.type == TOUCH_EV_UP ? ",0," : ",1,");
+            Serial.print(ev.x);
+            Serial.print(",");
+            Serial.println(ev.y);
+        }
+    }
+}
+
+const touch_state_t *touch_state(void)
+{
+    return &state;
+}
+
+uint8_t touch_frame_events(const touch_event_t **events)
+{
+    *events = frame_events;
+    return frame_count;
+}
+
+const touch_events_stats_t *touch_events_stats(void)
+{
+    return &stats;
+}
+
+void touch_events_trace(bool enable)
+{
+    trace = enable;
+    if (trace) {
+        Serial.println("t_ms,down,x,y");
+    }
+}
+
+//----------------------- LVGL input device ------------------------
+
+#if LVGL_VERSION_MAJOR == 9
+static void snapshot_read(lv_indev_t *indev, lv_indev_data_t *data)
+#elif LVGL_VERSION_MAJOR == 8
+static void snapshot_read(lv_indev_drv_t *indev_driver, lv_indev_data_t *data)
+#endif
+{
+    data->state   = state.touched ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->point.x = state.x;
+    data->point.y = state.y;
+}
+
+void touch_events_begin(void)
+{
+    memset(&state, 0, sizeof(state));
+    memset(&stats, 0, sizeof(stats));
+    ring_head = ring_tail = 0;
+    prod_down = false;
+    serviced  = isr_reports;
+
+    // Reads happen in touch_events_service(); Wire isn't usable from the ISR
+    pinMode(TOUCH_INT, INPUT_PULLUP);
+    attachInterrupt(digitalPinToInterrupt(TOUCH_INT), touch_events_isr, FALLING);
+
+    // Strips go out every few ms while a frame renders; reports get read
+    // there instead of waiting for the next loop() pass
+    lv_xiao_disp_set_poll_cb(touch_events_service);
+
+    // LVGL would otherwise do its own I2C read on every indev poll
+    lv_indev_t *indev = lv_xiao_touch_indev();
+    if (indev) {
+#if LVGL_VERSION_MAJOR == 9
+        lv_indev_set_read_cb(indev, snapshot_read);
+#elif LVGL_VERSION_MAJOR == 8
+        indev->driver->read_cb = snapshot_read;
+#endif
+    }
+}
@@ -0,0 +1,92 @@
+#ifndef TOUCH_EVENTS_H
+#define TOUCH_EVENTS_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+
+// Touch input settings
+#define TOUCH_QUEUE_LEN     32    // events, must be a power of two
+#define TOUCH_RELEASE_MS    60    // no report for this long with INT high = lifted
+#define TOUCH_HOLD_READ_MS  20    // re-read while INT is held low without new edges
+
+typedef enum {
+    TOUCH_EV_DOWN = 0,
+    TOUCH_EV_MOVE,
+    TOUCH_EV_UP
+} touch_ev_type_t;
+
+typedef struct {
+    uint32_t   ms;      // millis() of the controller report
+    lv_coord_t x, y;    // screen coordinates, clamped to the panel
+    uint8_t    type;    // touch_ev_type_t
+} touch_event_t;
+
+// What every consumer sees for the current loop() pass
+typedef struct {
+    bool       down;      // finger on the panel after the last event
+    bool       touched;   // down at any point this pass, so short taps aren't lost
+    lv_coord_t x, y;      // last reported position
+    uint32_t   down_ms;   // when the current (or last) contact started
+    uint32_t   last_ms;   // time of the last event
+} touch_state_t;
+
+typedef struct {
+    uint32_t reports;      // controller reports signalled on TOUCH_INT
+    uint32_t reads;        // I2C reads actually issued
+    uint32_t read_errors;  // short I2C reads
+    uint32_t events;       // events queued
+    uint32_t dropped;      // events lost because the ring was full
+    uint32_t coalesced;    // reports folded into a later read, their points (MOVEs) lost
+    uint32_t unseen;       // contacts over before a read saw them; nothing is queued
+} touch_events_stats_t;
+
+/**
+ * @brief Attaches the TOUCH_INT interrupt, points LVGL's touch input device
+ *        at the event snapshot and has the display driver poll the producer
+ *        while it renders. Call after lv_xiao_touch_init().
+ */
+void touch_events_begin(void);
+
+// TOUCH_INT falling edge; public so a host fake controller can raise it
+void touch_events_isr(void);
+
+/**
+ * @brief Producer side. Does at most one chsc6x read for all reports signalled
+ *        since the last call and queues DOWN / MOVE / UP events from it.
+ *        The controller only has its current point, so reports that pile up
+ *        between two calls lose their positions (stats.coalesced). Cheap when
+ *        nothing is pending, so it is polled while the display renders and
+ *        while loop() idles (touch_events_wait()); that keeps it close to one
+ *        read per report. A contact that still comes and goes between two
+ *        reads is only counted in stats.unseen: its point was never read.
+ */
+void touch_events_service(void);
+
+/**
+ * @brief delay(ms) that keeps servicing reports as they arrive, so a tap
+ *        shorter than a loop() pass is read with its own position. Use it
+ *        for loop()'s idle time.
+ */
+void touch_events_wait(uint32_t ms);
+
+// Consumer side of the ring; false when empty
+bool touch_events_pop(touch_event_t *event);
+
+/**
+ * @brief Runs the producer, then drains the ring into the per-pass snapshot
+ *        and event list. Call once at the top of loop(); everything else only
+ *        reads the results.
+ */
+void touch_events_update(void);
+
+const touch_state_t *touch_state(void);
+
+// Events drained by the last touch_events_update(); returns their count
+uint8_t touch_frame_events(const touch_event_t **events);
+
+const touch_events_stats_t *touch_events_stats(void);
+
+// Prints every event as "t_ms,down,x,y", the trace format host/chsc6x_fake.h replays
+void touch_events_trace(bool enable);
+
+#endif // TOUCH_EVENTS_H
@@ -0,0 +1,276 @@
+#include "touch_gesture.h"
+
+//----------------------- Helpers ------------------------
+
+static touch_gesture_t *emit(touch_gesture_tracker_t *tracker, uint8_t type,
+                             lv_coord_t x, lv_coord_t y, uint32_t ms, uint32_t now_ms)
+{
+    if (tracker->out_count >= TOUCH_GESTURE_MAX_OUT) {
+        return NULL;
+    }
+    touch_gesture_t *g = &tracker->out[tracker->out_count++];
+    memset(g, 0, sizeof(*g));
+    g->type       = type;
+    g->x          = x;
+    g->y          = y;
+    g->dx         = x - tracker->start_x;
+    g->dy         = y - tracker->start_y;
+    g->ms         = ms;
+    g->emitted_ms = now_ms;
+    return g;
+}
+
+static void history_push(touch_gesture_tracker_t *tracker, lv_coord_t x, lv_coord_t y, uint32_t ms)
+{
+    if (tracker->hist_len == TOUCH_GESTURE_HISTORY) {
+        memmove(tracker->hist_x,  tracker->hist_x  + 1, (TOUCH_GESTURE_HISTORY - 1) * sizeof(lv_coord_t));
+        memmove(tracker->hist_y,  tracker->hist_y  + 1, (TOUCH_GESTURE_HISTORY - 1) * sizeof(lv_coord_t));
+        memmove(tracker->hist_ms, tracker->hist_ms + 1, (TOUCH_GESTURE_HISTORY - 1) * sizeof(uint32_t));
+        tracker->hist_len--;
+    }
+    tracker->hist_x[tracker->hist_len]  = x;
+    tracker->hist_y[tracker->hist_len]  = y;
+    tracker->hist_ms[tracker->hist_len] = ms;
+    tracker->hist_len++;
+}
+
+// px/s between the newest sample and the oldest one inside the velocity window
+static void velocity(const touch_gesture_tracker_t *tracker, int16_t *vx, int16_t *vy)
+{
+    *vx = *vy = 0;
+    if (tracker->hist_len < 2) {
+        return;
+    }
+
+    uint8_t  last = tracker->hist_len - 1;
+    uint8_t  first = last;
+    while (first > 0 && tracker->hist_ms[last] - tracker->hist_ms[first - 1] <= TOUCH_GESTURE_VELOCITY_MS) {
+        first--;
+    }
+    if (first == last) {
+        first = last - 1;   // one report interval is longer than the window
+    }
+
+    int32_t dt = tracker->hist_ms[last] - tracker->hist_ms[first];
+    if (dt <= 0) {
+        return;
+    }
+    *vx = (int32_t)(tracker->hist_x[last] - tracker->hist_x[first]) * 1000 / dt;
+    *vy = (int32_t)(tracker->hist_y[last] - tracker->hist_y[first]) * 1000 / dt;
+}
+
+static swipe_dir_t swipe_dir(int dx, int dy)
+{
+    if (abs(dx) > abs(dy)) {
+        return (dx < 0) ? SWIPE_DIR_LEFT : SWIPE_DIR_RIGHT;
+    }
+    return (dy < 0) ? SWIPE_DIR_UP : SWIPE_DIR_DOWN;
+}
+
+static bool outside_slop(const touch_gesture_tracker_t *tracker, lv_coord_t x, lv_coord_t y)
+{
+    int dx = x - tracker->start_x;
+    int dy = y - tracker->start_y;
+    return dx * dx + dy * dy > (int)tracker->tap_slop * tracker->tap_slop;
+}
+
+// Reports the held-back tap as a single one
+static void flush_tap(touch_gesture_tracker_t *tracker, uint32_t now_ms)
+{
+    if (!tracker->tap_pending) {
+        return;
+    }
+    tracker->tap_pending = false;
+    touch_gesture_t *g = emit(tracker, TOUCH_GESTURE_TAP, tracker->tap_x, tracker->tap_y,
+                              tracker->tap_ms, now_ms);
+    if (g) {
+        g->dx = g->dy = 0;
+    }
+}
+
+//----------------------- Setup ------------------------
+
+void touch_gesture_init(touch_gesture_tracker_t *tracker,
+                        int x_min, int x_max, int y_min, int y_max,
+                        int min_swipe_length)
+{
+    memset(tracker, 0, sizeof(*tracker));
+    tracker->x_min            = x_min;
+    tracker->x_max            = x_max;
+    tracker->y_min            = y_min;
+    tracker->y_max            = y_max;
+    tracker->min_swipe_length = min_swipe_length;
+    tracker->tap_slop         = TOUCH_GESTURE_TAP_SLOP;
+    tracker->long_press_ms    = TOUCH_GESTURE_LONG_PRESS_MS;
+    tracker->double_tap_ms    = TOUCH_GESTURE_DOUBLE_TAP_MS;
+    tracker->min_speed        = TOUCH_GESTURE_MIN_SPEED;
+}
+
+void touch_gesture_reset(touch_gesture_tracker_t *tracker)
+{
+    tracker->phase        = TOUCH_GESTURE_IDLE;
+    tracker->tap_pending  = false;
+    tracker->jump_pending = false;
+    tracker->hist_len    = 0;
+    tracker->out_count   = 0;
+}
+
+//----------------------- Recogniser ------------------------
+
+static void on_down(touch_gesture_tracker_t *tracker, const touch_event_t *ev, uint32_t now_ms)
+{
+    // Too late to pair with the earlier tap
+    if (tracker->tap_pending && ev->ms - tracker->tap_ms > tracker->double_tap_ms) {
+        flush_tap(tracker, now_ms);
+    }
+
+    if (ev->x < tracker->x_min || ev->x > tracker->x_max ||
+        ev->y < tracker->y_min || ev->y > tracker->y_max) {
+        return;
+    }
+
+    tracker->phase    = TOUCH_GESTURE_PRESSED;
+    tracker->start_x  = tracker->last_x = ev->x;
+    tracker->start_y  = tracker->last_y = ev->y;
+    tracker->start_ms = tracker->last_ms = ev->ms;
+    tracker->hist_len = 0;
+    tracker->jump_pending = false;
+    history_push(tracker, ev->x, ev->y, ev->ms);
+}
+
+static void on_move(touch_gesture_tracker_t *tracker, const touch_event_t *ev, uint32_t now_ms)
+{
+    if (tracker->phase == TOUCH_GESTURE_IDLE) {
+        return;
+    }
+
+    // The controller occasionally reports a point far off the finger. Drop a
+    // single one; if the next report lands near it, reports in between were
+    // lost and the finger really is there, so follow it from now on.
+    if (abs(ev->x - tracker->last_x) > TOUCH_GESTURE_MAX_JUMP ||
+        abs(ev->y - tracker->last_y) > TOUCH_GESTURE_MAX_JUMP) {
+        bool confirmed = tracker->jump_pending &&
+                         abs(ev->x - tracker->jump_x) <= TOUCH_GESTURE_MAX_JUMP &&
+                         abs(ev->y - tracker->jump_y) <= TOUCH_GESTURE_MAX_JUMP;
+        if (!confirmed) {
+            tracker->jump_pending = true;
+            tracker->jump_x       = ev->x;
+            tracker->jump_y       = ev->y;
+            return;
+        }
+    }
+    tracker->jump_pending = false;
+
+    tracker->last_x  = ev->x;
+    tracker->last_y  = ev->y;
+    tracker->last_ms = ev->ms;
+    history_push(tracker, ev->x, ev->y, ev->ms);
+
+    if (tracker->phase == TOUCH_GESTURE_PRESSED && outside_slop(tracker, ev->x, ev->y)) {
+        tracker->phase = TOUCH_GESTURE_DRAGGING;
+        flush_tap(tracker, now_ms);   // a drag can't be the second half of a double tap
+    }
+    if (tracker->phase == TOUCH_GESTURE_DRAGGING) {
+        // Several moves in one pass collapse into one DRAG, so they can't crowd out the release
+        if (tracker->out_count > 0 && tracker->out[tracker->out_count - 1].type == TOUCH_GESTURE_DRAG) {
+            tracker->out_count--;
+        }
+        touch_gesture_t *g = emit(tracker, TOUCH_GESTURE_DRAG, ev->x, ev->y, ev->ms, now_ms);
+        if (g) {
+            velocity(tracker, &g->vx, &g->vy);
+        }
+    }
+}
+
+static void on_up(touch_gesture_tracker_t *tracker, const touch_event_t *ev, uint32_t now_ms)
+{
+    uint8_t phase  = tracker->phase;
+    tracker->phase = TOUCH_GESTURE_IDLE;
+
+    if (phase == TOUCH_GESTURE_PRESSED) {
+        if (tracker->tap_pending && tracker->start_ms - tracker->tap_ms <= tracker->double_tap_ms) {
+            tracker->tap_pending = false;
+            emit(tracker, TOUCH_GESTURE_DOUBLE_TAP, tracker->last_x, tracker->last_y, ev->ms, now_ms);
+        } else if (tracker->double_tap_ms == 0) {
+            emit(tracker, TOUCH_GESTURE_TAP, tracker->last_x, tracker->last_y, ev->ms, now_ms);
+        } else {
+            // Reported by touch_gesture_tick() once no second tap came
+            tracker->tap_pending = true;
+            tracker->tap_x       = tracker->last_x;
+            tracker->tap_y       = tracker->last_y;
+            tracker->tap_ms      = ev->ms;
+        }
+    } else if (phase == TOUCH_GESTURE_DRAGGING) {
+        int16_t vx, vy;
+        velocity(tracker, &vx, &vy);
+
+        int  dx    = tracker->last_x - tracker->start_x;
+        int  dy    = tracker->last_y - tracker->start_y;
+        bool far   = abs(dx) >= tracker->min_swipe_length || abs(dy) >= tracker->min_swipe_length;
+        bool quick = (int32_t)vx * vx + (int32_t)vy * vy >= (int32_t)tracker->min_speed * tracker->min_speed;
+
+        touch_gesture_t *g = emit(tracker, (far && quick) ? TOUCH_GESTURE_SWIPE : TOUCH_GESTURE_DRAG_END,
+                                  tracker->last_x, tracker->last_y, ev->ms, now_ms);
+        if (g) {
+            g->vx = vx;
+            g->vy = vy;
+            if (g->type == TOUCH_GESTURE_SWIPE) {
+                g->dir = swipe_dir(dx, dy);
+            }
+        }
+    }
+    // TOUCH_GESTURE_HELD: the long press was already reported
+}
+
+uint8_t touch_gesture_feed(touch_gesture_tracker_t *tracker, const touch_event_t *event, uint32_t now_ms)
+{
+    switch (event->type) {
+    case TOUCH_EV_DOWN: on_down(tracker, event, now_ms); break;
+    case TOUCH_EV_MOVE: on_move(tracker, event, now_ms); break;
+    case TOUCH_EV_UP:   on_up(tracker, event, now_ms);   break;
+    }
+    return tracker->out_count;
+}
+
+uint8_t touch_gesture_tick(touch_gesture_tracker_t *tracker, uint32_t now_ms)
+{
+    if (tracker->phase == TOUCH_GESTURE_PRESSED && now_ms - tracker->start_ms >= tracker->long_press_ms) {
+        tracker->phase = TOUCH_GESTURE_HELD;
+        flush_tap(tracker, now_ms);
+        emit(tracker, TOUCH_GESTURE_LONG_PRESS, tracker->last_x, tracker->last_y,
+             tracker->start_ms + tracker->long_press_ms, now_ms);
+    }
+
+    // Only once the finger is up; a new press may still turn it into a double tap
+    if (tracker->tap_pending && tracker->phase == TOUCH_GESTURE_IDLE &&
+        now_ms - tracker->tap_ms > tracker->double_tap_ms) {
+        flush_tap(tracker, now_ms);
+    }
+    return tracker->out_count;
+}
+
+uint8_t touch_gesture_update(touch_gesture_tracker_t *tracker)
+{
+    uint32_t now = millis();
+    tracker->out_count = 0;
+
+    const touch_event_t *events;
+    uint8_t count = touch_frame_events(&events);
+    for (uint8_t i = 0; i < count; i++) {
+        touch_gesture_feed(tracker, &events[i], now);
+    }
+    return touch_gesture_tick(tracker, now);
+}
+
+const char *touch_gesture_name(uint8_t type)
+{
+    switch (type) {
+    case TOUCH_GESTURE_TAP:        return "tap";
+    case TOUCH_GESTURE_DOUBLE_TAP: return "double-tap";
+    case TOUCH_GESTURE_LONG_PRESS: return "long-press";
+    case TOUCH_GESTURE_SWIPE:      return "swipe";
+    case TOUCH_GESTURE_DRAG:       return "drag";
+    case TOUCH_GESTURE_DRAG_END:   return "drag-end";
+    default:                       return "none";
+    }
+}
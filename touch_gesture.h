@@ -0,0 +1,120 @@
+#ifndef TOUCH_GESTURE_H
+#define TOUCH_GESTURE_H
+
+#include <Arduino.h>
+#include <lvgl.h>
+#include "touch_events.h"
+
+// Recogniser defaults, per tracker after touch_gesture_init()
+#define TOUCH_GESTURE_TAP_SLOP      8     // px a press may wander and still be a tap / long-press
+#define TOUCH_GESTURE_LONG_PRESS_MS 600
+#define TOUCH_GESTURE_DOUBLE_TAP_MS 250   // second tap must start within this; 0 = no double taps
+#define TOUCH_GESTURE_MIN_SPEED     150   // px/s at release for a drag to count as a swipe
+#define TOUCH_GESTURE_VELOCITY_MS   60    // velocity is measured over the last this many ms
+#define TOUCH_GESTURE_MAX_JUMP      80    // px; a single move further than this in one report is a glitch
+#define TOUCH_GESTURE_HISTORY       4     // samples kept for the velocity estimate
+#define TOUCH_GESTURE_MAX_OUT       4     // gestures one update can emit
+
+// Directions
+typedef enum {
+    SWIPE_DIR_NONE = 0,
+    SWIPE_DIR_LEFT,
+    SWIPE_DIR_RIGHT,
+    SWIPE_DIR_UP,
+    SWIPE_DIR_DOWN
+} swipe_dir_t;
+
+typedef enum {
+    TOUCH_GESTURE_NONE = 0,
+    TOUCH_GESTURE_TAP,
+    TOUCH_GESTURE_DOUBLE_TAP,
+    TOUCH_GESTURE_LONG_PRESS,
+    TOUCH_GESTURE_SWIPE,
+    TOUCH_GESTURE_DRAG,          // finger still down and moving, sent on every move
+    TOUCH_GESTURE_DRAG_END       // released after a drag that wasn't fast enough for a swipe
+} touch_gesture_type_t;
+
+typedef struct {
+    uint8_t    type;             // touch_gesture_type_t
+    uint8_t    dir;              // swipe_dir_t, swipes only
+    lv_coord_t x, y;             // where it happened (tap point / current or end point)
+    lv_coord_t dx, dy;           // from the press start
+    int16_t    vx, vy;           // px/s at the end of the movement
+    uint32_t   ms;               // time of the touch sample that completed it
+    uint32_t   emitted_ms;       // when the recogniser reported it
+} touch_gesture_t;
+
+typedef enum {
+    TOUCH_GESTURE_IDLE = 0,
+    TOUCH_GESTURE_PRESSED,       // down, hasn't left the tap slop yet
+    TOUCH_GESTURE_DRAGGING,
+    TOUCH_GESTURE_HELD           // long press reported, waiting for the release
+} touch_gesture_phase_t;
+
+typedef struct {
+    // Settings
+    lv_coord_t x_min, x_max, y_min, y_max;   // a press has to start in here
+    uint16_t   min_swipe_length;
+    uint16_t   tap_slop;
+    uint16_t   long_press_ms;
+    uint16_t   double_tap_ms;
+    uint16_t   min_speed;
+
+    // State
+    uint8_t    phase;            // touch_gesture_phase_t
+    lv_coord_t start_x, start_y;
+    uint32_t   start_ms;
+    lv_coord_t last_x, last_y;
+    uint32_t   last_ms;
+
+    // A move further than TOUCH_GESTURE_MAX_JUMP, held back until the next
+    // report shows whether it was a glitch or the finger really got there
+    bool       jump_pending;
+    lv_coord_t jump_x, jump_y;
+
+    // Recent samples for the velocity estimate
+    lv_coord_t hist_x[TOUCH_GESTURE_HISTORY];
+    lv_coord_t hist_y[TOUCH_GESTURE_HISTORY];
+    uint32_t   hist_ms[TOUCH_GESTURE_HISTORY];
+    uint8_t    hist_len;
+
+    // A tap held back while we wait to see whether a second one follows
+    bool       tap_pending;
+    lv_coord_t tap_x, tap_y;
+    uint32_t   tap_ms;
+
+    // Output of the last feed / tick / update
+    touch_gesture_t out[TOUCH_GESTURE_MAX_OUT];
+    uint8_t         out_count;
+} touch_gesture_tracker_t;
+
+/**
+ * @brief Sets a tracker up with the default timings. Presses that start
+ *        outside the box are ignored; after that the finger may leave it.
+ */
+void touch_gesture_init(touch_gesture_tracker_t *tracker,
+                        int x_min, int x_max, int y_min, int y_max,
+                        int min_swipe_length);
+
+// Drops any press in progress and any pending tap
+void touch_gesture_reset(touch_gesture_tracker_t *tracker);
+
+/**
+ * @brief Feeds one touch event. Gestures it completes are appended to
+ *        tracker->out; nothing is cleared, so feed() and tick() can be called
+ *        in any order within one pass. Returns out_count.
+ */
+uint8_t touch_gesture_feed(touch_gesture_tracker_t *tracker, const touch_event_t *event, uint32_t now_ms);
+
+// Time based gestures: long-press while held, and a single tap once the double-tap window closes
+uint8_t touch_gesture_tick(touch_gesture_tracker_t *tracker, uint32_t now_ms);
+
+/**
+ * @brief Clears tracker->out, feeds this pass's events (touch_frame_events())
+ *        and ticks. Call after touch_events_update(); never blocks.
+ */
+uint8_t touch_gesture_update(touch_gesture_tracker_t *tracker);
+
+const char *touch_gesture_name(uint8_t type);
+
+#endif // TOUCH_GESTURE_H
@@ -1,6 +1,7 @@
 #include "touch_sensor_functions.h"
 #define USE_ARDUINO_GFX_LIBRARY // make sure this goes before xiao round screen lib
 #include "lv_xiao_round_screen.h"
+#include "touch_events.h"
 #include <Arduino.h>
 #include <math.h>
 
@@ -26,28 +27,16 @@ bool is_within_circle_bounds(int x, int y, int center_x, int center_y, int radiu
 
 //----------------------- Touch Validation ------------------------
 
+// Both read the snapshot touch_events_update() took for this loop() pass,
+// so any number of callers cost no extra I2C traffic
 bool validate_touch(lv_coord_t* touchX, lv_coord_t* touchY) {
-    if (!chsc6x_is_pressed()) {
-        return false; 
+    const touch_state_t *touch = touch_state();
+    if (!touch->touched) {
+        return false;
     }
-    // Read coords
-    chsc6x_get_xy(touchX, touchY);
-
-    // Debug printing
-    Serial.print("validate_touch -> raw coords: (");
-    Serial.print(*touchX); 
-    Serial.print(", "); 
-    Serial.print(*touchY);
-    Serial.println(")");
-
-    // Instead of rejecting out-of-bounds, clamp them:
-    if (*touchX > 240) *touchX = 240;
-    if (*touchY > 240) *touchY = 240;
-    
-    // Possibly clamp to 0 as well, if negative values appear:
-    // if (*touchX < 0) *touchX = 0;
-    // if (*touchY < 0) *touchY = 0;
-
+    // Already clamped to the panel by the event queue
+    *touchX = touch->x;
+    *touchY = touch->y;
     return true;
 }
 
@@ -57,12 +46,9 @@ bool validate_touch(lv_coord_t* touchX, lv_coord_t* touchY) {
 bool get_touch(lv_coord_t* x, lv_coord_t* y, bool print) {
   lv_coord_t touchX, touchY;
 
-  if (chsc6x_is_pressed()) {
-    chsc6x_get_xy(&touchX, &touchY);
-    if (touchX > 240 || touchY > 240) {
-      touchX = 0;
-      touchY = 0;
-    }
+  if (validate_touch(&touchX, &touchY)) {
+    *x = touchX;
+    *y = touchY;
     if(print){
       Serial.print("Touch coordinates: X = ");
       Serial.print(touchX);
@@ -168,87 +154,36 @@ bool get_touch_in_area_circle(int center_x, int center_y, int radius, bool view)
 
 //------------------- Press Handling --------------------------
 
-// Helper function to wait for touch release
-void wait_for_release() {
-    while (chsc6x_is_pressed()) {
-        delay(10);
-    }
-}
+// Nothing in here waits: each update looks at the snapshot touch_events_update()
+// took for this pass and moves the detector on by the time that has passed
 
-// Helper function to handle press timing
-bool handle_press_timing(bool isInArea, unsigned long& pressStart, bool& isPressed) {
-    if (isInArea) {
-        if (!isPressed) {
-            pressStart = millis();
-            isPressed = true;
-        }
-        return true;
-    }
-    isPressed = false;
-    return false;
-}
-
-/* 
- *  pressed(...) 
- * 
- *  Blocks in a 'while(true)' loop until either:
- *   1) The user presses in the specified area for 'duration' ms (returns true), or 
- *   2) The user releases or moves out of the area before that time (returns false).
- */
-bool pressed(int duration, int x_min, int x_max, int y_min, int y_max, bool view) {
-    lv_coord_t touchX, touchY;
-    unsigned long pressStart = 0;
-    bool isPressed = false;
+void hold_init(hold_detector_t *hold, int duration, int x_min, int x_max, int y_min, int y_max, bool view) {
+    memset(hold, 0, sizeof(*hold));
+    hold->x_min    = x_min;
+    hold->x_max    = x_max;
+    hold->y_min    = y_min;
+    hold->y_max    = y_max;
+    hold->duration = duration;
 
     if (view) {
         lv_area_t area = {x_min, y_min, x_max, y_max};
         draw_area(area, false, true);
     }
-
-    // Blocking loop
-    while (true) {
-        // Check for valid touch
-        if (validate_touch(&touchX, &touchY)) {
-            bool isInArea = is_within_square_bounds(touchX, touchY, x_min, x_max, y_min, y_max);
-
-            if (isInArea) {
-                // If not previously pressed, mark a new press start time
-                if (!isPressed) {
-                    pressStart = millis();
-                    isPressed  = true;
-                }
-
-                // If enough time has elapsed, success
-                if (millis() - pressStart >= (unsigned long)duration) {
-                    return true;
-                }
-            }
-            else {
-                // Touched outside the area => reset
-                isPressed  = false;
-                pressStart = 0;
-            }
-        }
-        else {
-            // No valid touch -> if we were tracking a press, it means user released
-            if (isPressed) {
-                return false;
-            }
-            delay(10); // Avoid busy waiting
-        }
-    }
 }
 
-bool pressed_center(int duration, int center_x, int center_y, int half_width, int half_height, bool view) {
-    return pressed(duration,
-                   center_x - half_width, center_x + half_width,
-                   center_y - half_height, center_y + half_height, view);
+void hold_init_center(hold_detector_t *hold, int duration, int center_x, int center_y, int half_width, int half_height, bool view) {
+    hold_init(hold, duration,
+              center_x - half_width, center_x + half_width,
+              center_y - half_height, center_y + half_height, view);
 }
 
-bool pressed_circle(int duration, int center_x, int center_y, int radius, bool view) {
-    lv_coord_t touchX, touchY;
-    unsigned long pressStart = 0;
-    bool isPressed = false;
+void hold_init_circle(hold_detector_t *hold, int duration, int center_x, int center_y, int radius, bool view) {
+    memset(hold, 0, sizeof(*hold));
+    hold->is_circle = true;
+    hold->center_x  = center_x;
+    hold->center_y  = center_y;
+    hold->radius    = radius;
+    hold->duration  = duration;
 
     if (view) {
         lv_area_t area = {
@@ -257,36 +192,109 @@ bool pressed_circle(int duration, int center_x, int center_y, int radius, bool v
         };
         draw_area(area, true, true);
     }
+}
+
+void hold_set_cb(hold_detector_t *hold, hold_cb_t cb, void *user_data) {
+    hold->cb        = cb;
+    hold->user_data = user_data;
+}
+
+static void hold_notify(hold_detector_t *hold, hold_event_t event) {
+    if (hold->cb) {
+        hold->cb(hold, event);
+    }
+}
 
-    // Blocking loop
-    while (true) {
-        if (validate_touch(&touchX, &touchY)) {
-            bool isInArea = is_within_circle_bounds(touchX, touchY, center_x, center_y, radius);
+uint8_t hold_update(hold_detector_t *hold) {
+    hold->completed = false;
+    hold->cancelled = false;
 
-            if (isInArea) {
-                if (!isPressed) {
-                    pressStart = millis();
-                    isPressed  = true;
-                }
-                if (millis() - pressStart >= (unsigned long)duration) {
-                    return true;
+    const touch_state_t *touch = touch_state();
+    bool isInArea = false;
+    if (touch->down) {
+        isInArea = hold->is_circle
+            ? is_within_circle_bounds(touch->x, touch->y, hold->center_x, hold->center_y, hold->radius)
+            : is_within_square_bounds(touch->x, touch->y, hold->x_min, hold->x_max, hold->y_min, hold->y_max);
+    }
+
+    switch (hold->state) {
+    case HOLD_IDLE:
+        if (isInArea) {
+            hold->state    = HOLD_HOLDING;
+            hold->start_ms = millis();
+            hold->progress = 0;
+            hold_notify(hold, HOLD_EVENT_START);
+        }
+        break;
+
+    case HOLD_HOLDING:
+        if (!isInArea) {
+            // Released or slid out before the time was up
+            hold->state     = HOLD_IDLE;
+            hold->progress  = 0;
+            hold->cancelled = true;
+            hold_notify(hold, HOLD_EVENT_CANCEL);
+            break;
+        }
+        {
+            uint32_t elapsed = millis() - hold->start_ms;
+            if (elapsed >= hold->duration) {
+                hold->state     = HOLD_DONE;
+                hold->progress  = 100;
+                hold->completed = true;
+                hold_notify(hold, HOLD_EVENT_DONE);
+            } else {
+                uint8_t progress = elapsed * 100 / hold->duration;
+                if (progress != hold->progress) {
+                    hold->progress = progress;
+                    hold_notify(hold, HOLD_EVENT_PROGRESS);
                 }
             }
-            else {
-                isPressed  = false;
-                pressStart = 0;
-            }
         }
-        else {
-            // Released or invalid => if previously pressed, user let go
-            if (isPressed) {
-                return false;
-            }
-            delay(10);
+        break;
+
+    case HOLD_DONE:
+        // One completion per press
+        if (!touch->down) {
+            hold->state    = HOLD_IDLE;
+            hold->progress = 0;
         }
+        break;
     }
+    return hold->progress;
 }
 
+void hold_update_all(hold_detector_t *holds, uint8_t count) {
+    for (uint8_t i = 0; i < count; i++) {
+        hold_update(&holds[i]);
+    }
+}
 
+static void hold_timer_cb(lv_timer_t *timer) {
+#if LVGL_VERSION_MAJOR == 9
+    hold_group_t *group = (hold_group_t *)lv_timer_get_user_data(timer);
+#else
+    hold_group_t *group = (hold_group_t *)timer->user_data;
+#endif
+    hold_update_all(group->holds, group->count);
+}
 
+bool hold_timer_start(hold_group_t *group, hold_detector_t *holds, uint8_t count, uint32_t period_ms) {
+    group->holds = holds;
+    group->count = count;
 
+    // Restarting keeps the one timer
+    if (group->timer) {
+        lv_timer_set_period(group->timer, period_ms);
+        return true;
+    }
+    group->timer = lv_timer_create(hold_timer_cb, period_ms, group);
+    return group->timer != NULL;
+}
+
+void hold_timer_stop(hold_group_t *group) {
+    if (group->timer) {
+        lv_timer_del(group->timer);
+        group->timer = NULL;
+    }
+}
@@ -29,10 +29,59 @@ bool get_touch_in_area(int x_min, int x_max, int y_min, int y_max, bool view = f
 bool get_touch_in_area_center(int center_x, int center_y, int half_width, int half_height, bool view = false);
 bool get_touch_in_area_circle(int center_x, int center_y, int radius, bool view = false);
 
-// Press (hold) functions
-bool pressed(int duration, int x_min, int x_max, int y_min, int y_max, bool view = false);
-bool pressed_center(int duration, int center_x, int center_y, int half_width, int half_height, bool view = false);
-bool pressed_circle(int duration, int center_x, int center_y, int radius, bool view = false);
+// Press (hold) detectors: ticked once per pass, never block
+typedef enum {
+    HOLD_IDLE = 0,
+    HOLD_HOLDING,     // finger inside, timing
+    HOLD_DONE,        // held for 'duration'; stays here until the finger lifts
+} hold_state_t;
+
+typedef enum {
+    HOLD_EVENT_START = 0,
+    HOLD_EVENT_PROGRESS,
+    HOLD_EVENT_DONE,
+    HOLD_EVENT_CANCEL,    // released or moved out before 'duration'
+} hold_event_t;
+
+struct hold_detector_t;
+typedef void (*hold_cb_t)(struct hold_detector_t *hold, hold_event_t event);
+
+typedef struct hold_detector_t {
+    bool          is_circle;
+    int           x_min, x_max, y_min, y_max;   // rectangle
+    int           center_x, center_y, radius;   // circle
+    uint32_t      duration;                     // ms to hold
+
+    uint8_t       state;       // hold_state_t
+    uint32_t      start_ms;
+    uint8_t       progress;    // 0..100 % of duration
+    bool          completed;   // true for the one update that reached duration
+    bool          cancelled;   // true for the one update that gave up
+
+    hold_cb_t     cb;          // optional, e.g. to drive a progress arc
+    void         *user_data;
+} hold_detector_t;
+
+void hold_init(hold_detector_t *hold, int duration, int x_min, int x_max, int y_min, int y_max, bool view = false);
+void hold_init_center(hold_detector_t *hold, int duration, int center_x, int center_y, int half_width, int half_height, bool view = false);
+void hold_init_circle(hold_detector_t *hold, int duration, int center_x, int center_y, int radius, bool view = false);
+void hold_set_cb(hold_detector_t *hold, hold_cb_t cb, void *user_data);
+
+// Advances one detector from the current touch snapshot; returns its progress
+uint8_t hold_update(hold_detector_t *hold);
+void    hold_update_all(hold_detector_t *holds, uint8_t count);
+
+// Detectors ticked from an lv_timer instead of loop(). The group is the
+// timer's context, so it must outlive it; zero it before the first start.
+typedef struct {
+    hold_detector_t *holds;
+    uint8_t          count;
+    lv_timer_t      *timer;
+} hold_group_t;
+
+// Ticks 'count' detectors every period_ms; on a running group, swaps them in
+bool hold_timer_start(hold_group_t *group, hold_detector_t *holds, uint8_t count, uint32_t period_ms);
+void hold_timer_stop(hold_group_t *group);
 
 
 
@@ -0,0 +1,84 @@
+#ifndef TRIG_LUT_H
+#define TRIG_LUT_H
+
+#include <stdint.h>
+
+/*
+  Q15 sine / cosine looked up by decidegree, the unit LVGL animates angles in
+  (0..3600 = one turn). The quarter wave 0..900 is computed by the compiler
+  and lands in flash (1.8 KB); the other quadrants are mirrored from it, so a
+  lookup is a modulo, two compares and one load, with no float at all.
+
+  TRIG_Q15_ONE stands for 1.0, like LVGL's own lv_trigo_sin().
+*/
+#define TRIG_Q15_ONE      32767
+#define TRIG_QUARTER      900       // decidegrees in a quarter turn
+#define TRIG_TURN         3600
+
+//----------------------- Compile-time generation ------------------------
+
+// sin(x) for 0 <= x <= pi/2, Taylor series; written for C++11 constexpr
+static constexpr double trig_sin_terms(double x2, double term, int k)
+{
+    return k > 12 ? 0.0 : term + trig_sin_terms(x2, -term * x2 / ((2.0 * k) * (2.0 * k + 1.0)), k + 1);
+}
+
+static constexpr int16_t trig_q15(int decideg)
+{
+    return (int16_t)(trig_sin_terms((decideg * 3.14159265358979323846 / 1800.0) *
+                                    (decideg * 3.14159265358979323846 / 1800.0),
+                                    decideg * 3.14159265358979323846 / 1800.0, 1) * TRIG_Q15_ONE + 0.5);
+}
+
+// 0..N-1 as a parameter pack, built in log depth to stay under the template depth limit
+template <int... I> struct trig_seq {};
+
+template <class A, class B> struct trig_cat;
+template <int... A, int... B> struct trig_cat<trig_seq<A...>, trig_seq<B...> > {
+    typedef trig_seq<A..., (int)sizeof...(A) + B...> type;
+};
+
+template <int N> struct trig_make_seq {
+    typedef typename trig_cat<typename trig_make_seq<N / 2>::type,
+                              typename trig_make_seq<N - N / 2>::type>::type type;
+};
+template <> struct trig_make_seq<0> { typedef trig_seq<> type; };
+template <> struct trig_make_seq<1> { typedef trig_seq<0> type; };
+
+template <class S> struct trig_table;
+template <int... I> struct trig_table<trig_seq<I...> > {
+    static constexpr int16_t q15[sizeof...(I)] = { trig_q15(I)... };
+};
+template <int... I> constexpr int16_t trig_table<trig_seq<I...> >::q15[sizeof...(I)];
+
+typedef trig_table<trig_make_seq<TRIG_QUARTER + 1>::type> trig_quarter_t;
+
+//----------------------- Lookup ------------------------
+
+// sin(angle) * TRIG_Q15_ONE; angle in decidegrees, any value
+static inline int16_t trig_sin_q15(int32_t angle)
+{
+    angle %= TRIG_TURN;
+    if (angle < 0) {
+        angle += TRIG_TURN;
+    }
+
+    const int16_t *q = trig_quarter_t::q15;
+    if (angle <= TRIG_QUARTER) {
+        return q[angle];
+    }
+    if (angle <= 2 * TRIG_QUARTER) {
+        return q[2 * TRIG_QUARTER - angle];
+    }
+    if (angle <= 3 * TRIG_QUARTER) {
+        return -q[angle - 2 * TRIG_QUARTER];
+    }
+    return -q[TRIG_TURN - angle];
+}
+
+static inline int16_t trig_cos_q15(int32_t angle)
+{
+    return trig_sin_q15(angle + TRIG_QUARTER);
+}
+
+#endif // TRIG_LUT_H